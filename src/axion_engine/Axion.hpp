@@ -19,6 +19,7 @@
 
 #include "axion_engine/core/events/Event.hpp"
 #include "axion_engine/core/events/EventBus.hpp"
+#include "axion_engine/core/jobs/JobSystem.hpp"
 
 // Platform
 #include "axion_engine/platform/window/Window.hpp"
@@ -38,9 +39,16 @@
 // Runtime Classes
 #include "axion_engine/runtime/classes/scene/Scene.hpp"
 #include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
+#include "axion_engine/runtime/classes/prefab/Prefab.hpp"
+#include "axion_engine/runtime/classes/pool/ObjectPool.hpp"
+#include "axion_engine/runtime/classes/serialization/ComponentRegistry.hpp"
+#include "axion_engine/runtime/classes/serialization/SceneSerializer.hpp"
+#include "axion_engine/runtime/classes/snapshot/SceneSnapshot.hpp"
+#include "axion_engine/runtime/classes/snapshot/SnapshotHistory.hpp"
 
 // Interfaces
 #include "axion_engine/runtime/interfaces/IUpdateable.hpp"
+#include "axion_engine/runtime/interfaces/IParallelUpdateable.hpp"
 #include "axion_engine/runtime/interfaces/IRenderable.hpp"
 #include "axion_engine/runtime/interfaces/ICollisionListener.hpp"
 
@@ -65,5 +73,7 @@
 #include "axion_engine/runtime/components/renderer/TextRenderComponent.hpp"
 
 // Utilities
+#include "axion_utilities/file/MappedFile.hpp"
+#include "axion_utilities/spatial/LooseQuadtree.hpp"
 #include "axion_utilities/path/PathFinder.hpp"
 #include "axion_utilities/vector_filter/PtrVectorFilter.hpp"
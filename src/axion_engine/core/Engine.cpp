@@ -18,7 +18,11 @@ Engine::Engine(EngineConfig config, WindowConfig windowConfig)
     events_ = std::make_unique<EventBus>();
     context_.events = events_.get();
 
-    sdlManager_.InitSDL();
+    jobs_ = std::make_unique<JobSystem>(config_.workerThreads);
+    context_.jobs = jobs_.get();
+    logger_->Info("JobSystem started with {} worker threads.", jobs_->GetWorkerCount());
+
+    sdlManager_.InitSDL(windowConfig.headless == HeadlessMode::Disabled);
 
     window_.Start(windowConfig);
     context_.window = &window_;
@@ -34,6 +38,8 @@ Engine::Engine(EngineConfig config, WindowConfig windowConfig)
     context_.inputProvider = input_.get();  // ISP interface
 
     scene_ = std::make_unique<SceneManager>(context_);
+    scene_->SetTeardownBudget(config_.sceneTeardownBudgetMs);
+    scene_->SetScriptBudget(config_.scriptBudgetMs);
     context_.scene = scene_.get();
     context_.sceneProvider = scene_.get();  // ISP interface
 
@@ -47,11 +53,17 @@ Engine::Engine(EngineConfig config, WindowConfig windowConfig)
     context_.assets = assets_.get();
     context_.assetProvider = assets_.get();  // ISP interface
 
+    fonts_ = std::make_unique<FontManager>(context_);
+    context_.fonts = fonts_.get();
+
     logger_->Separator("Engine Managers Initialized");
 }
 
 Engine::~Engine()
 {
+    // Releases fonts, atlas pages and static chunk textures while SDL is still up
+    fonts_.reset();
+    render_.reset();
     sdlManager_.QuitSDL();
 }
 
@@ -63,7 +75,16 @@ void Engine::Run()
     {
         EventLoop();
         AppLoop();
-        SDL_Delay(config_.updateDelay);
+
+        if (config_.maxFrames > 0 && ++frameCount_ >= config_.maxFrames)
+        {
+            logger_->Info("Reached {} frames. Stopping engine.", frameCount_);
+            state_ = EngineState::Stopped;
+        }
+        else
+        {
+            SDL_Delay(config_.updateDelay);
+        }
     }
 }
 
@@ -73,6 +94,7 @@ void Engine::EventLoop()
     while (SDL_PollEvent(&event_))
     {
         input_->ProcessEvent(event_);
+        render_->ProcessEvent(event_);
 
         if (event_.type == SDL_QUIT)
         {
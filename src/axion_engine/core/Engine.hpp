@@ -16,8 +16,10 @@
 #include "axion_engine/managers/physics/PhysicsManager.hpp"
 #include "axion_engine/managers/render/RenderManager.hpp"
 #include "axion_engine/managers/assets/AssetsManager.hpp"
+#include "axion_engine/managers/font/FontManager.hpp"
 
 #include "axion_engine/core/events/EventBus.hpp"
+#include "axion_engine/core/jobs/JobSystem.hpp"
 
 namespace Axion
 {
@@ -72,7 +74,8 @@ public:
     /**
      * @brief Starts the main game loop.
      * 
-     * This method blocks until the engine receives a quit signal.
+     * This method blocks until the engine receives a quit signal, or
+     * until EngineConfig::maxFrames frames have run.
      * The loop processes input, updates game logic, runs physics,
      * and renders each frame.
      */
@@ -96,10 +99,12 @@ private:
     Window window_;
 
     EngineState state_ = EngineState::Stopped;
+    uint64_t frameCount_ = 0;
 
     std::unique_ptr<Logger> logger_;
     std::unique_ptr<Analyzer> analyzer_;
     std::unique_ptr<EventBus> events_;
+    std::unique_ptr<JobSystem> jobs_;
 
     std::unique_ptr<TimeManager> time_;
     std::unique_ptr<InputManager> input_;
@@ -107,6 +112,7 @@ private:
     std::unique_ptr<PhysicsManager> physics_;
     std::unique_ptr<RenderManager> render_;
     std::unique_ptr<AssetsManager> assets_;
+    std::unique_ptr<FontManager> fonts_;
 
     void EventLoop();
     void AppLoop();
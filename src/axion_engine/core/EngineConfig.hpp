@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace Axion
 {
 
@@ -16,6 +19,23 @@ struct EngineConfig
 
     /** @brief Maximum number of log files to keep before cleanup. Default is 5. */
     std::size_t maxLogFiles = 5;
+
+    /** @brief Number of JobSystem worker threads. Default 0 uses hardware threads - 1. */
+    unsigned workerThreads = 0;
+
+    /** @brief Milliseconds per frame spent releasing the objects of a previous scene. Default is 1ms. */
+    float sceneTeardownBudgetMs = 1.0f;
+
+    /** @brief Milliseconds per frame given to budgeted scripts (see ScriptableComponent). Default is 1ms. */
+    float scriptBudgetMs = 1.0f;
+
+    /**
+     * @brief Frames after which Run() returns on its own. Default 0 runs until quit.
+     *
+     * Combined with WindowConfig::headless and updateDelay = 0, lets soak
+     * tests and frame-time benchmarks run unattended.
+     */
+    uint64_t maxFrames = 0;
 };
 
 } // namespace Axion
\ No newline at end of file
@@ -16,8 +16,10 @@ class SceneManager;
 class PhysicsManager;
 class RenderManager;
 class AssetsManager;
+class FontManager;
 class Window;
 class EventBus;
+class JobSystem;
 
 /**
  * @brief Central context providing access to all engine subsystems.
@@ -54,8 +56,10 @@ struct EngineContext
     PhysicsManager* physics = nullptr;  ///< Physics simulation subsystem
     RenderManager* render = nullptr;    ///< Rendering subsystem
     AssetsManager* assets = nullptr;    ///< Asset loading and caching
+    FontManager* fonts = nullptr;       ///< Fonts and the glyph atlas
     Window* window = nullptr;           ///< Window and renderer access
     EventBus* events = nullptr;         ///< Event publish-subscribe system
+    JobSystem* jobs = nullptr;          ///< Shared work-stealing thread pool
 };
 
 } // namespace Axion
\ No newline at end of file
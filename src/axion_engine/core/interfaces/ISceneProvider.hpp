@@ -23,6 +23,12 @@ public:
      * @param sceneName Name of the registered scene to switch to
      */
     virtual void RequestChange(std::string sceneName) = 0;
+
+    /**
+     * @brief Starts building a scene ahead of time, so a later change to it is instant.
+     * @param sceneName Name of the registered scene to preload
+     */
+    virtual void Preload(std::string sceneName) = 0;
     
     /**
      * @brief Returns the currently active scene.
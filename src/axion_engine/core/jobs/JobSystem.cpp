@@ -0,0 +1,147 @@
+#include "JobSystem.hpp"
+
+#include <algorithm>
+
+namespace Axion
+{
+
+namespace
+{
+
+thread_local const JobSystem* tlsOwner = nullptr;
+thread_local size_t tlsQueueIndex = 0;
+
+} // namespace
+
+JobSystem::JobSystem(unsigned workerCount)
+{
+    if (workerCount == 0)
+    {
+        const unsigned hw = std::thread::hardware_concurrency();
+        workerCount = hw > 1 ? hw - 1 : 1;
+    }
+
+    queues_.reserve(workerCount + 1);
+    for (unsigned i = 0; i <= workerCount; ++i)
+        queues_.push_back(std::make_unique<TaskQueue>());
+
+    workers_.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i)
+        workers_.emplace_back(&JobSystem::WorkerLoop, this, static_cast<size_t>(i + 1));
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        running_.store(false);
+    }
+    wake_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+void JobSystem::Submit(Job job, JobCounter* counter)
+{
+    if (counter)
+        counter->pending_.fetch_add(1, std::memory_order_relaxed);
+
+    TaskQueue& queue = *queues_[CurrentQueueIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back({std::move(job), counter});
+    }
+    queued_.fetch_add(1, std::memory_order_release);
+
+    // Taking the sleep mutex orders this wake-up after a worker's predicate check
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    wake_.notify_one();
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+    const size_t queueIndex = CurrentQueueIndex();
+    while (!counter.IsDone())
+    {
+        if (!TryRunOne(queueIndex))
+            std::this_thread::yield();
+    }
+}
+
+void JobSystem::WorkerLoop(size_t queueIndex)
+{
+    tlsOwner = this;
+    tlsQueueIndex = queueIndex;
+
+    while (running_.load(std::memory_order_acquire))
+    {
+        if (TryRunOne(queueIndex))
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wake_.wait(lock, [this]
+        {
+            return !running_.load() || queued_.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+size_t JobSystem::CurrentQueueIndex() const
+{
+    return tlsOwner == this ? tlsQueueIndex : 0;
+}
+
+bool JobSystem::TryRunOne(size_t queueIndex)
+{
+    Task task;
+    if (!TryPop(queueIndex, task) && !TrySteal(queueIndex, task))
+        return false;
+
+    queued_.fetch_sub(1, std::memory_order_relaxed);
+    Execute(task);
+    return true;
+}
+
+bool JobSystem::TryPop(size_t queueIndex, Task& out)
+{
+    TaskQueue& queue = *queues_[queueIndex];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+
+    out = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool JobSystem::TrySteal(size_t thiefIndex, Task& out)
+{
+    const size_t count = queues_.size();
+    for (size_t offset = 1; offset < count; ++offset)
+    {
+        TaskQueue& victim = *queues_[(thiefIndex + offset) % count];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty())
+            continue;
+
+        out = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void JobSystem::Execute(Task& task)
+{
+    task.job();
+    if (task.counter)
+        task.counter->pending_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+} // namespace Axion
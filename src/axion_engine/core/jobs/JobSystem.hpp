@@ -0,0 +1,161 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Axion
+{
+
+/** @brief Unit of work executed by the JobSystem. */
+using Job = std::function<void()>;
+
+/**
+ * @brief Tracks completion of a group of jobs.
+ *
+ * Pass the same counter to several JobSystem::Submit() calls, then
+ * JobSystem::Wait() on it to block until all of them have finished.
+ */
+class JobCounter
+{
+public:
+    /** @brief Returns true once every job attached to this counter has run. */
+    bool IsDone() const { return pending_.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::atomic<int> pending_{0};
+};
+
+/**
+ * @brief Work-stealing thread pool.
+ *
+ * Each worker owns a deque: it pushes and pops its own jobs at the back
+ * (LIFO, cache friendly) and steals from the front of the other deques when
+ * it runs dry. Jobs submitted from threads outside the pool go to a shared
+ * deque that every worker steals from.
+ *
+ * One instance is created by Engine (see EngineConfig::workerThreads) and
+ * shared through EngineContext::jobs, so physics, scene updates, asset
+ * decoding and rendering preparation all draw from the same workers.
+ *
+ * @par Usage:
+ * @code
+ * jobs().ParallelFor(bodies.size(), 128, [&](size_t begin, size_t end) {
+ *     for (size_t i = begin; i < end; ++i)
+ *         Integrate(bodies[i]);
+ * });
+ *
+ * JobCounter counter;
+ * for (auto& chunk : chunks)
+ *     jobs.Submit([&chunk] { Process(chunk); }, &counter);
+ * jobs.Wait(counter); // the calling thread helps while waiting
+ * @endcode
+ *
+ * @note Jobs must not throw.
+ */
+class JobSystem
+{
+public:
+    /**
+     * @brief Starts the worker threads.
+     * @param workerCount Number of workers, 0 picks hardware threads - 1
+     */
+    explicit JobSystem(unsigned workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief Queues a job.
+     * @param job Work to run on any thread of the pool
+     * @param counter Optional counter incremented now and decremented when the job finishes
+     */
+    void Submit(Job job, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Blocks until the counter reaches zero, running queued jobs meanwhile.
+     * @param counter Counter passed to Submit()
+     */
+    void Wait(JobCounter& counter);
+
+    /**
+     * @brief Runs fn over [0, count) split into ranges of grainSize elements.
+     *
+     * Blocks until every range has run; the calling thread helps. Ranges
+     * run concurrently, so fn must only touch data owned by its range.
+     *
+     * @param count Number of elements
+     * @param grainSize Elements per job (work at or below it runs inline)
+     * @param fn Callable invoked as fn(begin, end)
+     */
+    template <typename Fn>
+    void ParallelFor(size_t count, size_t grainSize, Fn&& fn);
+
+    /** @brief Returns the number of worker threads. */
+    unsigned GetWorkerCount() const { return static_cast<unsigned>(workers_.size()); }
+
+private:
+    struct Task
+    {
+        Job job;
+        JobCounter* counter = nullptr;
+    };
+
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void WorkerLoop(size_t queueIndex);
+    size_t CurrentQueueIndex() const;
+    bool TryRunOne(size_t queueIndex);
+    bool TryPop(size_t queueIndex, Task& out);
+    bool TrySteal(size_t thiefIndex, Task& out);
+    void Execute(Task& task);
+
+    // Queue 0 is shared by external threads, queue i + 1 belongs to worker i
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::atomic<bool> running_{true};
+    std::atomic<size_t> queued_{0};
+
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+};
+
+template <typename Fn>
+inline void JobSystem::ParallelFor(size_t count, size_t grainSize, Fn&& fn)
+{
+    if (count == 0)
+        return;
+    if (grainSize == 0)
+        grainSize = 1;
+
+    if (count <= grainSize || workers_.empty())
+    {
+        fn(size_t(0), count);
+        return;
+    }
+
+    JobCounter counter;
+    for (size_t begin = grainSize; begin < count; begin += grainSize)
+    {
+        const size_t end = begin + grainSize < count ? begin + grainSize : count;
+        Submit([&fn, begin, end] { fn(begin, end); }, &counter);
+    }
+
+    // The first range runs on the calling thread
+    fn(size_t(0), grainSize);
+    Wait(counter);
+}
+
+} // namespace Axion
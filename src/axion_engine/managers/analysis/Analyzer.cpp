@@ -95,6 +95,14 @@ void Analyzer::Reset()
     metrics_ = PerformanceMetrics{};
 }
 
+void Analyzer::RecordRenderStats(const RenderStats& stats)
+{
+    metrics_.drawCalls = stats.drawCalls;
+    metrics_.renderBatches = stats.batches;
+    metrics_.renderablesDrawn = stats.drawn;
+    metrics_.renderablesCulled = stats.culled;
+}
+
 float Analyzer::GetSectionTime(const std::string& name) const
 {
     auto it = sectionTimes_.find(name);
@@ -33,6 +33,23 @@ struct PerformanceMetrics
     // Scene
     size_t renderableCount = 0;     ///< Objects being rendered
     size_t colliderCount = 0;       ///< Active colliders
+
+    // Rendering
+    size_t drawCalls = 0;           ///< Renderer draw calls last frame
+    size_t renderBatches = 0;       ///< Batched geometry submissions last frame
+    size_t renderablesDrawn = 0;    ///< Renderables drawn last frame
+    size_t renderablesCulled = 0;   ///< Renderables culled as off-screen last frame
+};
+
+/**
+ * @brief Render statistics of one frame, reported by RenderManager.
+ */
+struct RenderStats
+{
+    size_t drawCalls = 0;          ///< Renderer draw calls (batches and direct draws)
+    size_t batches = 0;            ///< Batched geometry submissions
+    size_t drawn = 0;              ///< Renderables drawn
+    size_t culled = 0;             ///< Renderables skipped as off-screen
 };
 
 /**
@@ -65,6 +82,7 @@ private:
  * - FPS tracking (current, average, min, max, 1% low)
  * - Frame time analysis and jitter detection
  * - GameObject/Component counting
+ * - Draw call, batch and culling counts
  * - Section profiling with ScopedTimer
  * 
  * @par Usage:
@@ -92,6 +110,9 @@ public:
     /** @brief Returns the current performance metrics. */
     const PerformanceMetrics& GetMetrics() const { return metrics_; }
     
+    /** @brief Records the render statistics of the current frame (called by RenderManager). */
+    void RecordRenderStats(const RenderStats& stats);
+
     /** @brief Returns timing for a profiled section in ms. */
     float GetSectionTime(const std::string& name) const;
     
@@ -1,8 +1,42 @@
 #include "AssetsManager.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+
+#include "axion_engine/core/jobs/JobSystem.hpp"
+#include "axion_utilities/packing/SkylinePacker.hpp"
+
 namespace Axion
 {
 
+namespace
+{
+
+// Atlas descriptor, one record per line:
+//   axion-atlas 1 <atlasId>
+//   page <index> <image path>
+//   sprite <id> <page> <x> <y> <w> <h>
+constexpr const char* kAtlasMagic = "axion-atlas";
+constexpr int kAtlasVersion = 1;
+
+std::string AtlasPageId(const std::string& atlasId, size_t page)
+{
+    return atlasId + "#" + std::to_string(page);
+}
+
+// First page index not taken by an earlier build of the same atlas
+size_t FirstFreeAtlasPage(const AssetsManager& assets, const std::string& atlasId)
+{
+    size_t page = 0;
+    while (assets.GetTexture(AtlasPageId(atlasId, page)))
+        ++page;
+    return page;
+}
+
+} // namespace
+
 AssetsManager::AssetsManager(EngineContext& ctx) : ContextAware(ctx)
 {
     assetsRoot_ = GetPath("assets/");
@@ -11,62 +45,402 @@ AssetsManager::AssetsManager(EngineContext& ctx) : ContextAware(ctx)
 
 AssetsManager::~AssetsManager()
 {
+    for (AtlasImage& image : pendingAtlasImages_)
+    {
+        if (image.surface)
+            SDL_FreeSurface(image.surface);
+    }
+
+    // Also destroys the placeholder textures
+    if (placeholderRenderer_)
+        SDL_DestroyRenderer(placeholderRenderer_);
+    if (placeholderSurface_)
+        SDL_FreeSurface(placeholderSurface_);
     INFO("AssetsManager destroyed.");
 }
 
 SDL_Texture* AssetsManager::LoadTexture(const std::string& id, const std::string& relativePath)
 {
+    if (SDL_Texture* cached = GetTexture(id))
+        return cached;
+
+    SDL_Surface* surface = DecodeSurface(relativePath);
+    if (!surface)
+        return nullptr;
+
+    return CreateTexture(id, surface, relativePath);
+}
+
+SDL_Texture* AssetsManager::GetTexture(const std::string& id) const
+{
+    std::lock_guard<std::mutex> lock(texturesMutex_);
     auto it = textures_.find(id);
-    if (it != textures_.end())
-        return it->second;
+    if (it == textures_.end())
+        return nullptr;
+    return it->second;
+}
 
+SDL_Surface* AssetsManager::DecodeSurface(const std::string& relativePath) const
+{
     const std::string fullPath = assetsRoot_ + relativePath;
     SDL_Surface* surface = IMG_Load(fullPath.c_str());
 
     if (!surface)
-    {
         SDL_Log("IMG_Load failed (%s): %s", fullPath.c_str(), IMG_GetError());
+    return surface;
+}
+
+SDL_Texture* AssetsManager::CreateTexture(const std::string& id, SDL_Surface* surface, const std::string& relativePath)
+{
+    if (!surface)
         return nullptr;
+
+    // Another request may have loaded the same id while this one was decoding
+    if (SDL_Texture* cached = GetTexture(id))
+    {
+        SDL_FreeSurface(surface);
+        return cached;
     }
 
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(ctx_.window->GetRenderer(), surface);
+    SDL_Renderer* renderer = ctx_.window ? ctx_.window->GetRenderer() : nullptr;
+    SDL_Texture* texture = nullptr;
+    if (renderer)
+    {
+        texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (!texture)
+            SDL_Log("SDL_CreateTextureFromSurface failed: %s", SDL_GetError());
+    }
+    else if (SDL_Renderer* placeholder = GetPlaceholderRenderer())
+    {
+        // NoRender: only the size is kept, so sprites are culled and batched as in a drawn frame
+        texture = SDL_CreateTexture(placeholder, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, surface->w,
+                                    surface->h);
+    }
     SDL_FreeSurface(surface);
 
     if (!texture)
-    {
-        SDL_Log("SDL_CreateTextureFromSurface failed: %s", SDL_GetError());
         return nullptr;
-    }
 
+    std::lock_guard<std::mutex> lock(texturesMutex_);
     textures_[id] = texture;
+    sources_[texture] = {id, relativePath};
     return texture;
 }
 
-SDL_Texture* AssetsManager::GetTexture(const std::string& id) const
+SDL_Renderer* AssetsManager::GetPlaceholderRenderer()
 {
-    auto it = textures_.find(id);
-    if (it == textures_.end())
-        return nullptr;
-    return it->second;
+    if (placeholderRenderer_ || placeholderFailed_)
+        return placeholderRenderer_;
+
+    // Software rendering into memory needs no video driver
+    placeholderSurface_ = SDL_CreateRGBSurfaceWithFormat(0, 1, 1, 32, SDL_PIXELFORMAT_RGBA32);
+    if (placeholderSurface_)
+        placeholderRenderer_ = SDL_CreateSoftwareRenderer(placeholderSurface_);
+
+    if (!placeholderRenderer_)
+    {
+        WARN("Could not create placeholder textures without a renderer: {}", SDL_GetError());
+        placeholderFailed_ = true;
+    }
+    return placeholderRenderer_;
+}
+
+bool AssetsManager::GetTextureSource(SDL_Texture* texture, std::string& id, std::string& relativePath) const
+{
+    std::lock_guard<std::mutex> lock(texturesMutex_);
+    auto it = sources_.find(texture);
+    if (it == sources_.end())
+        return false;
+
+    id = it->second.id;
+    relativePath = it->second.relativePath;
+    return true;
 }
 
 void AssetsManager::UnloadTexture(const std::string& id)
 {
+    std::lock_guard<std::mutex> lock(texturesMutex_);
     auto it = textures_.find(id);
     if (it == textures_.end())
         return;
 
+    for (auto sprite = sprites_.begin(); sprite != sprites_.end();)
+    {
+        if (sprite->second.texture == it->second)
+            sprite = sprites_.erase(sprite);
+        else
+            ++sprite;
+    }
+
+    sources_.erase(it->second);
     SDL_DestroyTexture(it->second);
     textures_.erase(it);
 }
 
 void AssetsManager::UnloadAllTextures()
 {
+    std::lock_guard<std::mutex> lock(texturesMutex_);
     for (auto& [id, tex] : textures_)
     {
         SDL_DestroyTexture(tex);
     }
     textures_.clear();
+    sources_.clear();
+    sprites_.clear();
+}
+
+void AssetsManager::AddAtlasImage(const std::string& id, const std::string& relativePath)
+{
+    pendingAtlasImages_.push_back({id, relativePath, nullptr});
+}
+
+void AssetsManager::AddAtlasSurface(const std::string& id, SDL_Surface* surface, const std::string& relativePath)
+{
+    if (surface)
+        pendingAtlasImages_.push_back({id, relativePath, surface});
+}
+
+size_t AssetsManager::BuildAtlas(const std::string& atlasId, const AtlasSettings& settings)
+{
+    std::vector<AtlasImage> images;
+    images.swap(pendingAtlasImages_);
+    images.erase(std::remove_if(images.begin(), images.end(),
+                                [this](const AtlasImage& image)
+                                {
+                                    if (!GetSprite(image.id).IsValid())
+                                        return false;
+                                    if (image.surface)
+                                        SDL_FreeSurface(image.surface);
+                                    return true;
+                                }),
+                 images.end());
+    if (images.empty())
+        return 0;
+
+    // Images queued with AddAtlasSurface() are already decoded
+    std::vector<SDL_Surface*> surfaces(images.size(), nullptr);
+    for (size_t i = 0; i < images.size(); ++i)
+        surfaces[i] = images[i].surface;
+    auto decode = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!surfaces[i])
+                surfaces[i] = DecodeSurface(images[i].relativePath);
+        }
+    };
+    if (ctx_.jobs)
+        jobs().ParallelFor(images.size(), 1, decode);
+    else
+        decode(0, images.size());
+
+    // Tallest first packs tightest with a skyline
+    std::vector<size_t> order;
+    for (size_t i = 0; i < images.size(); ++i)
+    {
+        if (surfaces[i])
+            order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(),
+              [&](size_t a, size_t b)
+              {
+                  if (surfaces[a]->h != surfaces[b]->h)
+                      return surfaces[a]->h > surfaces[b]->h;
+                  return surfaces[a]->w > surfaces[b]->w;
+              });
+
+    const int pageSize = std::max(settings.pageSize, 1);
+    const int padding = std::max(settings.padding, 0);
+    std::vector<SkylinePacker> packers;
+    std::vector<size_t> pages(images.size(), SIZE_MAX);
+    std::vector<SDL_Rect> rects(images.size());
+    size_t added = 0;
+
+    for (size_t i : order)
+    {
+        const int w = surfaces[i]->w;
+        const int h = surfaces[i]->h;
+        PackedRect placed;
+
+        size_t page = 0;
+        while (page < packers.size() && !packers[page].Insert(w + padding, h + padding, placed))
+            ++page;
+        if (page == packers.size())
+        {
+            packers.emplace_back(pageSize, pageSize);
+            if (!packers.back().Insert(w + padding, h + padding, placed))
+            {
+                // Too large for a page: keep it as a texture of its own
+                packers.pop_back();
+                WARN("Atlas image '{}' ({}x{}) exceeds the {}px page size", images[i].id, w, h, pageSize);
+                if (SDL_Texture* texture = CreateTexture(images[i].id, surfaces[i], images[i].relativePath))
+                {
+                    std::lock_guard<std::mutex> lock(texturesMutex_);
+                    sprites_[images[i].id] = {texture, {0, 0, w, h}, w, h};
+                    ++added;
+                }
+                surfaces[i] = nullptr;
+                continue;
+            }
+        }
+
+        pages[i] = page;
+        rects[i] = {placed.x, placed.y, w, h};
+    }
+
+    const size_t firstPage = FirstFreeAtlasPage(*this, atlasId);
+    const std::string saveStem = settings.savePath.substr(0, settings.savePath.rfind('.'));
+    std::ostringstream descriptor;
+    descriptor << kAtlasMagic << ' ' << kAtlasVersion << ' ' << atlasId << '\n';
+
+    for (size_t page = 0; page < packers.size(); ++page)
+    {
+        // Pages are trimmed to what was packed into them
+        int pageWidth = 1;
+        int pageHeight = 1;
+        for (size_t i : order)
+        {
+            if (pages[i] != page || !surfaces[i])
+                continue;
+            pageWidth = std::max(pageWidth, rects[i].x + rects[i].w);
+            pageHeight = std::max(pageHeight, rects[i].y + rects[i].h);
+        }
+
+        SDL_Surface* pageSurface = SDL_CreateRGBSurfaceWithFormat(0, pageWidth, pageHeight, 32, SDL_PIXELFORMAT_RGBA32);
+        if (!pageSurface)
+        {
+            SDL_Log("SDL_CreateRGBSurfaceWithFormat failed: %s", SDL_GetError());
+            continue;
+        }
+
+        for (size_t i : order)
+        {
+            if (pages[i] != page || !surfaces[i])
+                continue;
+            // Copy the pixels as they are, alpha included
+            SDL_SetSurfaceBlendMode(surfaces[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(surfaces[i], nullptr, pageSurface, &rects[i]);
+        }
+
+        std::string pagePath;
+        if (!settings.savePath.empty())
+        {
+            pagePath = saveStem + "_" + std::to_string(page) + ".png";
+            if (IMG_SavePNG(pageSurface, (assetsRoot_ + pagePath).c_str()) != 0)
+                WARN("Failed to save atlas page '{}': {}", pagePath, IMG_GetError());
+            descriptor << "page " << page << ' ' << pagePath << '\n';
+        }
+
+        SDL_Texture* texture = CreateTexture(AtlasPageId(atlasId, firstPage + page), pageSurface, pagePath);
+        if (!texture)
+            continue;
+
+        std::lock_guard<std::mutex> lock(texturesMutex_);
+        for (size_t i : order)
+        {
+            if (pages[i] != page || !surfaces[i])
+                continue;
+            sprites_[images[i].id] = {texture, rects[i], pageWidth, pageHeight};
+            ++added;
+
+            const SDL_Rect& r = rects[i];
+            descriptor << "sprite " << images[i].id << ' ' << page << ' ' << r.x << ' ' << r.y << ' ' << r.w << ' '
+                       << r.h << '\n';
+        }
+    }
+
+    for (SDL_Surface* surface : surfaces)
+    {
+        if (surface)
+            SDL_FreeSurface(surface);
+    }
+
+    if (!settings.savePath.empty())
+    {
+        std::ofstream file(assetsRoot_ + settings.savePath, std::ios::trunc);
+        file << descriptor.str();
+        if (!file)
+            WARN("Failed to write atlas '{}'", settings.savePath);
+    }
+
+    INFO("Atlas '{}': {} sprites on {} pages", atlasId, added, packers.size());
+    return added;
+}
+
+bool AssetsManager::LoadAtlas(const std::string& relativePath)
+{
+    std::ifstream file(assetsRoot_ + relativePath);
+    if (!file)
+        return false;
+
+    std::string magic;
+    int version = 0;
+    std::string atlasId;
+    file >> magic >> version >> atlasId;
+    if (magic != kAtlasMagic || version != kAtlasVersion || atlasId.empty())
+    {
+        WARN("Invalid atlas file '{}'", relativePath);
+        return false;
+    }
+
+    const size_t firstPage = FirstFreeAtlasPage(*this, atlasId);
+    std::vector<SpriteHandle> pages; // Texture and size of each page
+    std::vector<std::pair<std::string, SpriteHandle>> sprites;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream record(line);
+        std::string kind;
+        if (!(record >> kind))
+            continue;
+
+        size_t page = 0;
+        if (kind == "page")
+        {
+            std::string pagePath;
+            if (!(record >> page >> pagePath))
+            {
+                WARN("Invalid atlas record in '{}': {}", relativePath, line);
+                return false;
+            }
+            if (page >= pages.size())
+                pages.resize(page + 1);
+            SpriteHandle& pageHandle = pages[page];
+            pageHandle.texture = LoadTexture(AtlasPageId(atlasId, firstPage + page), pagePath);
+            if (!pageHandle.texture)
+                return false;
+            SDL_QueryTexture(pageHandle.texture, nullptr, nullptr, &pageHandle.textureWidth, &pageHandle.textureHeight);
+        }
+        else if (kind == "sprite")
+        {
+            std::string id;
+            SDL_Rect rect{};
+            if (!(record >> id >> page >> rect.x >> rect.y >> rect.w >> rect.h) || page >= pages.size() ||
+                !pages[page].IsValid() || rect.x < 0 || rect.y < 0 || rect.w <= 0 || rect.h <= 0 ||
+                rect.w > pages[page].textureWidth - rect.x || rect.h > pages[page].textureHeight - rect.y)
+            {
+                WARN("Invalid atlas record in '{}': {}", relativePath, line);
+                return false;
+            }
+            SpriteHandle sprite = pages[page];
+            sprite.rect = rect;
+            sprites.push_back({id, sprite});
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(texturesMutex_);
+    for (auto& [id, sprite] : sprites)
+        sprites_[id] = sprite;
+    return true;
+}
+
+SpriteHandle AssetsManager::GetSprite(const std::string& id) const
+{
+    std::lock_guard<std::mutex> lock(texturesMutex_);
+    auto it = sprites_.find(id);
+    if (it == sprites_.end())
+        return {};
+    return it->second;
 }
 
 } // namespace Axion
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <SDL.h>
 #include <SDL_image.h>
 #include <filesystem>
@@ -10,12 +12,22 @@
 #include "axion_engine/structure/ContextAware.hpp"
 #include "axion_engine/platform/window/Window.hpp"
 #include "axion_engine/core/interfaces/IAssetProvider.hpp"
+#include "axion_engine/managers/assets/SpriteHandle.hpp"
 
 #include "axion_utilities/path/PathFinder.hpp"
 
 namespace Axion
 {
 
+/** @brief Settings for AssetsManager::BuildAtlas(). */
+struct AtlasSettings
+{
+    int pageSize = 2048;  ///< Maximum width and height of an atlas page in pixels
+    int padding = 1;      ///< Empty pixels between packed images, against filtering bleed
+    std::string savePath; ///< If set, the atlas is also written there (relative to the assets folder) for LoadAtlas();
+                          ///< sprite ids and paths must not contain whitespace
+};
+
 /**
  * @brief Manages loading and caching of game assets.
  * 
@@ -24,6 +36,30 @@ namespace Axion
  * by user-defined string IDs.
  * 
  * Implements IAssetProvider for decoupled asset loading.
+ *
+ * Loading is split in two steps so it can be spread over threads: image
+ * decoding (DecodeSurface()) touches no renderer state and may run on a
+ * worker thread, while texture creation (CreateTexture()) must happen on the
+ * main thread. The texture cache itself is safe to query from any thread.
+ *
+ * Without a renderer (HeadlessMode::NoRender) textures are placeholders of
+ * the image's size with no pixels uploaded, so render preparation sorts and
+ * culls sprites as it does when drawing.
+ *
+ * Small images that are drawn together should be packed into an atlas:
+ * sprites sharing a texture are drawn in one batch, while every separate
+ * texture costs at least one draw call.
+ *
+ * @par Usage (atlas):
+ * @code
+ * if (!assets().LoadAtlas("atlases/characters.atlas"))
+ * {
+ *     assets().AddAtlasImage("Player", "player.png");
+ *     assets().AddAtlasImage("Zombie", "zombie.png");
+ *     assets().BuildAtlas("Characters");
+ * }
+ * sprite->SetSprite(assets().GetSprite("Player"));
+ * @endcode
  */
 class AssetsManager : public ContextAware, public IAssetProvider
 {
@@ -46,6 +82,33 @@ public:
      */
     SDL_Texture* GetTexture(const std::string& id) const override;
 
+    /**
+     * @brief Decodes an image file into a surface without creating a texture.
+     * @param relativePath Path relative to the assets folder
+     * @return New surface owned by the caller, or nullptr on failure
+     * @note Thread-safe; intended for worker threads.
+     */
+    SDL_Surface* DecodeSurface(const std::string& relativePath) const;
+
+    /**
+     * @brief Creates and caches a texture from a decoded surface.
+     * @param id Unique identifier for the texture
+     * @param surface Surface from DecodeSurface(); always freed by this call
+     * @param relativePath Path the surface was decoded from, recorded for GetTextureSource()
+     * @return The cached texture (an existing one if the id is already loaded), or nullptr on failure
+     * @note Main thread only.
+     */
+    SDL_Texture* CreateTexture(const std::string& id, SDL_Surface* surface, const std::string& relativePath = {});
+
+    /**
+     * @brief Finds the id and file of a cached texture.
+     * @param texture Texture returned by this manager
+     * @param id Receives the texture id
+     * @param relativePath Receives the path relative to the assets folder (empty if unknown)
+     * @return False if the texture is not cached by this manager
+     */
+    bool GetTextureSource(SDL_Texture* texture, std::string& id, std::string& relativePath) const;
+
     /**
      * @brief Unloads a specific texture and frees its memory.
      * @param id Texture identifier to unload
@@ -55,9 +118,80 @@ public:
     /** @brief Unloads all cached textures. */
     void UnloadAllTextures();
 
+    /**
+     * @brief Queues an image for the next BuildAtlas().
+     * @param id Sprite identifier for GetSprite()
+     * @param relativePath Path relative to the assets folder
+     */
+    void AddAtlasImage(const std::string& id, const std::string& relativePath);
+
+    /**
+     * @brief Queues an already decoded image for the next BuildAtlas().
+     * @param id Sprite identifier for GetSprite()
+     * @param surface Surface from DecodeSurface(); owned by the manager from now on
+     * @param relativePath Source path, kept for the texture lookup
+     */
+    void AddAtlasSurface(const std::string& id, SDL_Surface* surface, const std::string& relativePath = {});
+
+    /**
+     * @brief Packs the queued images into atlas pages.
+     *
+     * Images not decoded yet are decoded on the job system, then packed largest first with a
+     * skyline packer and copied into as few pages as needed. Each page
+     * becomes a cached texture with the id "<atlasId>#<page>". Images larger
+     * than a page get a texture of their own. Ids that already have a sprite
+     * are skipped, so a scene may queue and build its atlas on every entry.
+     *
+     * @param atlasId Prefix for the page texture ids
+     * @return Number of sprites added
+     * @note Main thread only.
+     */
+    size_t BuildAtlas(const std::string& atlasId, const AtlasSettings& settings = {});
+
+    /**
+     * @brief Loads an atlas written by BuildAtlas() with AtlasSettings::savePath.
+     *
+     * Only the page images are decoded; nothing is packed at startup.
+     *
+     * @param relativePath Atlas descriptor path relative to the assets folder
+     * @return False if the file is missing or invalid
+     * @note Main thread only.
+     */
+    bool LoadAtlas(const std::string& relativePath);
+
+    /**
+     * @brief Retrieves a packed sprite.
+     * @param id Sprite identifier given to AddAtlasImage()
+     * @return The sprite, or an invalid handle if not found
+     */
+    SpriteHandle GetSprite(const std::string& id) const;
+
 private:
+    struct TextureSource
+    {
+        std::string id;
+        std::string relativePath;
+    };
+
+    struct AtlasImage
+    {
+        std::string id;
+        std::string relativePath;
+        SDL_Surface* surface = nullptr; // Null until decoded
+    };
+
+    // Renderer owning the placeholder textures (HeadlessMode::NoRender); created on first use
+    SDL_Renderer* GetPlaceholderRenderer();
+
     std::string assetsRoot_;
+    SDL_Surface* placeholderSurface_ = nullptr;
+    SDL_Renderer* placeholderRenderer_ = nullptr;
+    bool placeholderFailed_ = false;
     std::unordered_map<std::string, SDL_Texture*> textures_;
+    std::unordered_map<SDL_Texture*, TextureSource> sources_; // Reverse lookup, for scene files
+    std::unordered_map<std::string, SpriteHandle> sprites_;   // Packed atlas images
+    std::vector<AtlasImage> pendingAtlasImages_;              // Queued for the next BuildAtlas()
+    mutable std::mutex texturesMutex_; // Guards textures_, sources_ and sprites_; workers query them while decoding
 };
 
 } // namespace Axion
\ No newline at end of file
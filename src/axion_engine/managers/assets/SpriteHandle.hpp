@@ -0,0 +1,24 @@
+#pragma once
+#include <SDL.h>
+
+namespace Axion
+{
+
+/**
+ * @brief A sprite inside a texture: the texture, the source rectangle and the texture size.
+ *
+ * Returned by AssetsManager::GetSprite() for images packed into an atlas;
+ * pass it to SpriteRenderComponent::SetSprite().
+ */
+struct SpriteHandle
+{
+    SDL_Texture* texture = nullptr; ///< Texture holding the sprite (owned by AssetsManager)
+    SDL_Rect rect{0, 0, 0, 0};      ///< Source rectangle in pixels
+    int textureWidth = 0;           ///< Width of the whole texture, cached so drawing needs no SDL_QueryTexture
+    int textureHeight = 0;          ///< Height of the whole texture
+
+    /** @brief Returns true if the handle refers to a sprite. */
+    bool IsValid() const { return texture != nullptr; }
+};
+
+} // namespace Axion
@@ -0,0 +1,302 @@
+#include "FontManager.hpp"
+
+#include <algorithm>
+#include <filesystem>
+
+#include "axion_engine/platform/window/Window.hpp"
+#include "axion_utilities/path/PathFinder.hpp"
+
+namespace Axion
+{
+
+namespace
+{
+
+constexpr int kPageSize = 1024; // Width and height of an atlas page
+constexpr int kPadding = 1;     // Empty pixels between glyphs, against filtering bleed
+
+// Looked up in order when no default font is set
+const char* const kSystemFonts[] = {
+    "C:/Windows/Fonts/arial.ttf",
+    "C:/Windows/Fonts/calibri.ttf",
+    "C:/Windows/Fonts/segoeui.ttf",
+    "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+    "/usr/share/fonts/TTF/DejaVuSans.ttf",
+    "/usr/share/fonts/dejavu/DejaVuSans.ttf",
+    "/System/Library/Fonts/Supplemental/Arial.ttf",
+};
+
+// Decodes the code point at text[i] and advances i; invalid bytes decode as U+FFFD
+uint32_t NextCodepoint(std::string_view text, size_t& i)
+{
+    const auto lead = static_cast<unsigned char>(text[i++]);
+    if (lead < 0x80)
+        return lead;
+
+    int length = 0;
+    uint32_t codepoint = 0;
+    if ((lead & 0xE0) == 0xC0)
+    {
+        length = 1;
+        codepoint = lead & 0x1F;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        length = 2;
+        codepoint = lead & 0x0F;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        length = 3;
+        codepoint = lead & 0x07;
+    }
+    else
+    {
+        return 0xFFFD;
+    }
+
+    for (int k = 0; k < length; ++k)
+    {
+        if (i >= text.size() || (static_cast<unsigned char>(text[i]) & 0xC0) != 0x80)
+            return 0xFFFD;
+        codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[i++]) & 0x3F);
+    }
+    return codepoint;
+}
+
+} // namespace
+
+FontManager::FontManager(EngineContext& ctx) : ContextAware(ctx)
+{
+    assetsRoot_ = GetPath("assets/");
+    INFO("FontManager initialized.");
+}
+
+FontManager::~FontManager()
+{
+    for (auto& [key, font] : fonts_)
+    {
+        if (font && font->owned_)
+            TTF_CloseFont(font->ttf_);
+    }
+    for (Page& page : pages_)
+        SDL_DestroyTexture(page.texture);
+    INFO("FontManager destroyed.");
+}
+
+void FontManager::SetDefaultFont(const std::string& path)
+{
+    defaultFont_ = std::filesystem::path(path).is_absolute() ? path : assetsRoot_ + path;
+    defaultResolved_ = true;
+}
+
+Font* FontManager::GetFont(const std::string& path, int size)
+{
+    const std::string fullPath = path.empty() ? ResolveDefaultFont() : assetsRoot_ + path;
+    if (fullPath.empty())
+        return nullptr;
+
+    const std::string key = fullPath + '#' + std::to_string(size);
+    auto it = fonts_.find(key);
+    if (it != fonts_.end())
+        return it->second.get();
+    return OpenFont(key, fullPath, size);
+}
+
+Font* FontManager::GetFont(TTF_Font* font)
+{
+    if (!font)
+        return nullptr;
+
+    std::unique_ptr<Font>& entry = externalFonts_[font];
+    if (!entry)
+    {
+        entry = std::make_unique<Font>();
+        entry->ttf_ = font;
+        entry->owned_ = false;
+        entry->height_ = TTF_FontHeight(font);
+        entry->lineSkip_ = TTF_FontLineSkip(font);
+    }
+    return entry.get();
+}
+
+void FontManager::Layout(Font& font, std::string_view text, TextLayout& out)
+{
+    out.quads.clear();
+
+    int penX = 0;
+    int lineTop = 0;
+    int width = 0;
+    uint32_t previous = 0;
+
+    size_t i = 0;
+    while (i < text.size())
+    {
+        const uint32_t codepoint = NextCodepoint(text, i);
+        if (codepoint == '\n')
+        {
+            width = std::max(width, penX);
+            penX = 0;
+            lineTop += font.lineSkip_;
+            previous = 0;
+            continue;
+        }
+
+        if (previous != 0)
+            penX += GetKerning(font, previous, codepoint);
+        previous = codepoint;
+
+        const Glyph& glyph = GetGlyph(font, codepoint);
+        if (glyph.texture)
+        {
+            GlyphQuad quad;
+            quad.texture = glyph.texture;
+            quad.rect = {static_cast<float>(penX + glyph.offsetX), static_cast<float>(lineTop),
+                         static_cast<float>(glyph.rect.w), static_cast<float>(glyph.rect.h)};
+            quad.uvMin = {static_cast<float>(glyph.rect.x) / kPageSize, static_cast<float>(glyph.rect.y) / kPageSize};
+            quad.uvMax = {static_cast<float>(glyph.rect.x + glyph.rect.w) / kPageSize,
+                          static_cast<float>(glyph.rect.y + glyph.rect.h) / kPageSize};
+            out.quads.push_back(quad);
+        }
+        penX += glyph.advance;
+    }
+
+    width = std::max(width, penX);
+    out.size = glm::vec2(static_cast<float>(width), static_cast<float>(lineTop + font.height_));
+}
+
+const Glyph& FontManager::GetGlyph(Font& font, uint32_t codepoint)
+{
+    auto it = font.glyphs_.find(codepoint);
+    if (it != font.glyphs_.end())
+        return it->second;
+
+    Glyph& glyph = font.glyphs_[codepoint];
+
+    int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+    if (TTF_GlyphMetrics32(font.ttf_, codepoint, &minX, &maxX, &minY, &maxY, &advance) != 0)
+        return glyph;
+    glyph.advance = advance;
+    glyph.offsetX = std::min(minX, 0);
+
+    // Blank glyphs only move the pen; without a renderer (NoRender) only metrics are kept
+    SDL_Renderer* renderer = ctx_.window ? ctx_.window->GetRenderer() : nullptr;
+    if (!renderer || maxX <= minX || maxY <= minY)
+        return glyph;
+
+    // Rasterized in white, tinted by vertex color when drawn
+    SDL_Surface* surface = TTF_RenderGlyph32_Blended(font.ttf_, codepoint, SDL_Color{255, 255, 255, 255});
+    if (!surface)
+        return glyph;
+
+    if (!AddToAtlas(renderer, surface, glyph))
+        WARN("Glyph U+{:04X} ({}x{}) does not fit the glyph atlas", codepoint, surface->w, surface->h);
+    SDL_FreeSurface(surface);
+    return glyph;
+}
+
+int FontManager::GetKerning(Font& font, uint32_t left, uint32_t right)
+{
+    const uint64_t key = static_cast<uint64_t>(left) << 32 | right;
+    auto it = font.kerning_.find(key);
+    if (it != font.kerning_.end())
+        return it->second;
+
+    const int kerning = TTF_GetFontKerningSizeGlyphs32(font.ttf_, left, right);
+    font.kerning_.emplace(key, kerning);
+    return kerning;
+}
+
+bool FontManager::AddToAtlas(SDL_Renderer* renderer, SDL_Surface* surface, Glyph& glyph)
+{
+    if (surface->w + kPadding > kPageSize || surface->h + kPadding > kPageSize)
+        return false;
+
+    PackedRect placed;
+    Page* page = nullptr;
+    for (Page& candidate : pages_)
+    {
+        if (candidate.packer.Insert(surface->w + kPadding, surface->h + kPadding, placed))
+        {
+            page = &candidate;
+            break;
+        }
+    }
+
+    if (!page)
+    {
+        SDL_Texture* texture =
+            SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, kPageSize, kPageSize);
+        if (!texture)
+        {
+            WARN("Could not create a glyph atlas page: {}", SDL_GetError());
+            return false;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+
+        // Static textures start undefined
+        const std::vector<Uint32> clear(static_cast<size_t>(kPageSize) * kPageSize, 0);
+        SDL_UpdateTexture(texture, nullptr, clear.data(), kPageSize * static_cast<int>(sizeof(Uint32)));
+
+        pages_.push_back(Page{texture, SkylinePacker(kPageSize, kPageSize)});
+        page = &pages_.back();
+        page->packer.Insert(surface->w + kPadding, surface->h + kPadding, placed);
+    }
+
+    SDL_Surface* converted = surface;
+    if (surface->format->format != SDL_PIXELFORMAT_ARGB8888)
+    {
+        converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        if (!converted)
+            return false;
+    }
+
+    glyph.texture = page->texture;
+    glyph.rect = {placed.x, placed.y, surface->w, surface->h};
+    SDL_UpdateTexture(page->texture, &glyph.rect, converted->pixels, converted->pitch);
+
+    if (converted != surface)
+        SDL_FreeSurface(converted);
+    return true;
+}
+
+Font* FontManager::OpenFont(const std::string& key, const std::string& fullPath, int size)
+{
+    std::unique_ptr<Font>& entry = fonts_[key];
+
+    TTF_Font* ttf = TTF_OpenFont(fullPath.c_str(), size);
+    if (!ttf)
+    {
+        WARN("Could not open font '{}': {}", fullPath, TTF_GetError());
+        return nullptr;
+    }
+
+    entry = std::make_unique<Font>();
+    entry->ttf_ = ttf;
+    entry->height_ = TTF_FontHeight(ttf);
+    entry->lineSkip_ = TTF_FontLineSkip(ttf);
+    return entry.get();
+}
+
+std::string FontManager::ResolveDefaultFont()
+{
+    if (defaultResolved_)
+        return defaultFont_;
+    defaultResolved_ = true;
+
+    for (const char* path : kSystemFonts)
+    {
+        std::error_code error;
+        if (std::filesystem::exists(path, error))
+        {
+            defaultFont_ = path;
+            INFO("Default font: {}", defaultFont_);
+            return defaultFont_;
+        }
+    }
+
+    WARN("No default font found; call FontManager::SetDefaultFont()");
+    return defaultFont_;
+}
+
+} // namespace Axion
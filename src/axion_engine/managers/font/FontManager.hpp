@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+#include <SDL_ttf.h>
+#include <glm/glm.hpp>
+
+#include "axion_engine/structure/ContextAware.hpp"
+#include "axion_utilities/packing/SkylinePacker.hpp"
+
+namespace Axion
+{
+
+/** @brief A glyph rasterized into the glyph atlas. */
+struct Glyph
+{
+    SDL_Texture* texture = nullptr; ///< Atlas page holding the glyph, nullptr if it has no pixels (spaces)
+    SDL_Rect rect{0, 0, 0, 0};      ///< Glyph cell inside the page, one line high
+    int offsetX = 0;                ///< Left edge of the cell relative to the pen
+    int advance = 0;                ///< Pen movement after the glyph
+};
+
+/**
+ * @brief A font face at one size, with its glyphs and kerning cached.
+ *
+ * Obtained from FontManager::GetFont(), which owns it.
+ */
+class Font
+{
+public:
+    /** @brief Returns the height of a line of text in pixels. */
+    int GetHeight() const { return height_; }
+
+    /** @brief Returns the distance between two baselines in pixels. */
+    int GetLineSkip() const { return lineSkip_; }
+
+private:
+    friend class FontManager;
+
+    TTF_Font* ttf_ = nullptr;
+    bool owned_ = true; // False for fonts passed to FontManager::GetFont(TTF_Font*)
+    int height_ = 0;
+    int lineSkip_ = 0;
+    std::unordered_map<uint32_t, Glyph> glyphs_;   // By code point
+    std::unordered_map<uint64_t, int> kerning_;    // By (left << 32 | right) code points
+};
+
+/** @brief One glyph of a laid out string. */
+struct GlyphQuad
+{
+    SDL_Texture* texture = nullptr;
+    SDL_FRect rect{0.0f, 0.0f, 0.0f, 0.0f}; ///< Position in the text, from its top-left corner, in pixels
+    SDL_FPoint uvMin{0.0f, 0.0f};           ///< Normalized atlas coordinates of the top-left corner
+    SDL_FPoint uvMax{0.0f, 0.0f};           ///< Normalized atlas coordinates of the bottom-right corner
+};
+
+/** @brief A string laid out by FontManager::Layout(). */
+struct TextLayout
+{
+    std::vector<GlyphQuad> quads;
+    glm::vec2 size{0.0f}; ///< Width and height of the text in pixels
+};
+
+/**
+ * @brief Loads fonts and rasterizes their glyphs into a shared atlas.
+ *
+ * Each glyph is rasterized once, in white, into an atlas page packed with
+ * SkylinePacker; strings are then drawn as one textured quad per glyph,
+ * tinted by vertex color. Changing a text or its color therefore neither
+ * rasterizes nor uploads anything once its glyphs are known, and all text
+ * sharing an atlas page is drawn in one batch. Glyph metrics and kerning
+ * pairs are cached per font.
+ *
+ * Font paths are relative to the assets folder. An empty path selects the
+ * default font (SetDefaultFont()); when none is set, a common system font is
+ * looked up once.
+ *
+ * @note Main thread only.
+ */
+class FontManager : public ContextAware
+{
+public:
+    FontManager(EngineContext& ctx);
+    ~FontManager();
+
+    /**
+     * @brief Sets the font used for an empty path.
+     * @param path Font file, relative to the assets folder or absolute
+     */
+    void SetDefaultFont(const std::string& path);
+
+    /**
+     * @brief Returns a font, loading it on first use.
+     * @param path Font file relative to the assets folder, empty for the default font
+     * @param size Point size
+     * @return nullptr if the font cannot be opened (not retried)
+     */
+    Font* GetFont(const std::string& path, int size);
+
+    /** @brief Returns the Font wrapping an externally owned TTF font. */
+    Font* GetFont(TTF_Font* font);
+
+    /**
+     * @brief Lays out a UTF-8 string, rasterizing the glyphs it is missing.
+     *
+     * '\n' starts a new line.
+     *
+     * @param out Replaced with the glyph quads and the text size
+     */
+    void Layout(Font& font, std::string_view text, TextLayout& out);
+
+    /** @brief Returns the number of atlas pages created so far. */
+    size_t GetPageCount() const { return pages_.size(); }
+
+private:
+    struct Page
+    {
+        SDL_Texture* texture = nullptr;
+        SkylinePacker packer;
+    };
+
+    const Glyph& GetGlyph(Font& font, uint32_t codepoint);
+    int GetKerning(Font& font, uint32_t left, uint32_t right);
+    bool AddToAtlas(SDL_Renderer* renderer, SDL_Surface* surface, Glyph& glyph);
+    Font* OpenFont(const std::string& key, const std::string& fullPath, int size);
+    std::string ResolveDefaultFont();
+
+    std::vector<Page> pages_;
+    std::unordered_map<std::string, std::unique_ptr<Font>> fonts_; // Null entries for fonts that failed to open
+    std::unordered_map<TTF_Font*, std::unique_ptr<Font>> externalFonts_;
+
+    std::string assetsRoot_;
+    std::string defaultFont_;     // Full path, once resolved
+    bool defaultResolved_ = false;
+};
+
+} // namespace Axion
@@ -46,7 +46,8 @@ void PhysicsManager::FixedUpdate(float dt)
         currentScene->GetGameObjects(),
         [](GameObject &obj)
         {
-            return obj.GetComponent<RigidBody>() != nullptr && obj.IsEnabled() && !obj.IsDestroyed();
+            const RigidBody *body = obj.GetComponent<RigidBody>();
+            return body != nullptr && body->IsEnabled() && obj.IsEnabled() && !obj.IsDestroyed();
         });
 
     ProcessForces(GameObjectsWithRigidBody);
@@ -117,11 +118,11 @@ void PhysicsManager::ProcessCollisions(std::vector<GameObject *> &gameObjectsWit
             // Test each collider pair
             for (auto *colliderA : collidersA)
             {
-                if (!colliderA) continue;
+                if (!colliderA || !colliderA->IsEnabled()) continue;
                 
                 for (auto *colliderB : collidersB)
                 {
-                    if (!colliderB) continue;
+                    if (!colliderB || !colliderB->IsEnabled()) continue;
                     
                     auto pair = colliderA < colliderB
                                     ? std::make_pair(colliderA, colliderB)
@@ -173,9 +174,9 @@ void PhysicsManager::ProcessForces(std::vector<GameObject *> &gameObjectsWithRig
 
     glm::vec3 gravity = currentScene->Gravity;
 
-    for (auto *obj : gameObjectsWithRigidBody)
+    auto integrate = [&](GameObject& object)
     {
-        auto *rigidBody = obj->GetComponent<RigidBody>();
+        auto *rigidBody = object.GetComponent<RigidBody>();
         if (rigidBody)
         {
             // First integrate forces (including gravity) to update velocity
@@ -183,6 +184,28 @@ void PhysicsManager::ProcessForces(std::vector<GameObject *> &gameObjectsWithRig
             // Then integrate velocity to update position
             rigidBody->IntegrateVelocity(fixedDeltaTime_);
         }
+    };
+    auto isNested = [](GameObject& object)
+    {
+        TransformComponent *transform = object.GetTransform();
+        return transform && transform->GetParent();
+    };
+
+    // Moving a transform marks its whole subtree dirty, so only root bodies,
+    // whose subtrees are disjoint, integrate in parallel; nested ones follow serially
+    jobs().ParallelFor(gameObjectsWithRigidBody.size(), 256, [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!isNested(*gameObjectsWithRigidBody[i]))
+                integrate(*gameObjectsWithRigidBody[i]);
+        }
+    });
+
+    for (GameObject *object : gameObjectsWithRigidBody)
+    {
+        if (isNested(*object))
+            integrate(*object);
     }
 }
 
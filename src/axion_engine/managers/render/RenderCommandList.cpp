@@ -0,0 +1,217 @@
+#include "RenderCommandList.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Axion
+{
+
+namespace
+{
+
+constexpr float kCircleTolerance = 0.25f; // Max distance in pixels between a circle and its polygon
+constexpr int kMinCircleSegments = 8;
+constexpr int kMaxCircleSegments = 256;
+constexpr float kPi = 3.14159265358979f;
+
+int CircleSegments(float radius)
+{
+    if (radius <= kCircleTolerance)
+        return kMinCircleSegments;
+
+    // A chord of angle a lies radius * (1 - cos(a / 2)) inside the circle
+    const float step = 2.0f * std::acos(1.0f - kCircleTolerance / radius);
+    const int segments = static_cast<int>(std::ceil(2.0f * kPi / step));
+    return (std::clamp(segments, kMinCircleSegments, kMaxCircleSegments) + 3) / 4 * 4;
+}
+
+} // namespace
+
+void RenderCommandList::Clear()
+{
+    commands_.clear();
+    vertices_.clear();
+    indices_.clear();
+    points_.clear();
+    batched_ = 0;
+}
+
+void RenderCommandList::AddQuad(SDL_Texture* texture, const SDL_FPoint (&positions)[4], const SDL_FPoint (&uvs)[4],
+                                const SDL_Color& color)
+{
+    Command& command = OpenGeometry(texture);
+
+    const int base = static_cast<int>(command.count);
+    for (int i = 0; i < 4; ++i)
+        vertices_.push_back(SDL_Vertex{positions[i], color, uvs[i]});
+
+    const int quad[6] = {0, 1, 2, 0, 2, 3};
+    for (int index : quad)
+        indices_.push_back(base + index);
+
+    command.count += 4;
+    command.indexCount += 6;
+    ++batched_;
+}
+
+void RenderCommandList::AddTriangles(SDL_Texture* texture, const SDL_Vertex* vertices, int vertexCount,
+                                     const int* indices, int indexCount)
+{
+    if (vertexCount <= 0 || indexCount <= 0)
+        return;
+
+    Command& command = OpenGeometry(texture);
+
+    const int base = static_cast<int>(command.count);
+    vertices_.insert(vertices_.end(), vertices, vertices + vertexCount);
+    for (int i = 0; i < indexCount; ++i)
+        indices_.push_back(base + indices[i]);
+
+    command.count += static_cast<uint32_t>(vertexCount);
+    command.indexCount += static_cast<uint32_t>(indexCount);
+    ++batched_;
+}
+
+void RenderCommandList::AddCircle(const SDL_FPoint& center, float radius, const SDL_Color& color)
+{
+    if (radius <= 0.0f)
+        return;
+
+    Command& command = OpenGeometry(nullptr);
+
+    const std::vector<SDL_FPoint>& ring = GetRing(CircleSegments(radius));
+    const int segments = static_cast<int>(ring.size());
+    const int base = static_cast<int>(command.count);
+
+    vertices_.push_back(SDL_Vertex{center, color, {0.0f, 0.0f}});
+    for (const SDL_FPoint& direction : ring)
+        vertices_.push_back(SDL_Vertex{{center.x + direction.x * radius, center.y + direction.y * radius}, color, {0.0f, 0.0f}});
+
+    for (int i = 0; i < segments; ++i)
+    {
+        indices_.push_back(base);
+        indices_.push_back(base + 1 + i);
+        indices_.push_back(base + 1 + (i + 1) % segments);
+    }
+
+    command.count += static_cast<uint32_t>(segments + 1);
+    command.indexCount += static_cast<uint32_t>(segments * 3);
+    ++batched_;
+}
+
+void RenderCommandList::AddLines(const SDL_FPoint* points, int count, const SDL_Color& color)
+{
+    if (count < 2)
+        return;
+
+    Command command;
+    command.type = CommandType::Lines;
+    command.color = color;
+    command.first = static_cast<uint32_t>(points_.size());
+    command.count = static_cast<uint32_t>(count);
+    points_.insert(points_.end(), points, points + count);
+    commands_.push_back(command);
+}
+
+void RenderCommandList::AddPoints(const SDL_FPoint* points, int count, const SDL_Color& color)
+{
+    if (count <= 0)
+        return;
+
+    // Points of one color drawn back to back share a command
+    if (!commands_.empty())
+    {
+        Command& last = commands_.back();
+        if (last.type == CommandType::Points && last.color.r == color.r && last.color.g == color.g &&
+            last.color.b == color.b && last.color.a == color.a)
+        {
+            points_.insert(points_.end(), points, points + count);
+            last.count += static_cast<uint32_t>(count);
+            return;
+        }
+    }
+
+    Command command;
+    command.type = CommandType::Points;
+    command.color = color;
+    command.first = static_cast<uint32_t>(points_.size());
+    command.count = static_cast<uint32_t>(count);
+    points_.insert(points_.end(), points, points + count);
+    commands_.push_back(command);
+}
+
+SubmitStats RenderCommandList::Submit(SDL_Renderer* renderer) const
+{
+    SubmitStats stats;
+    if (!renderer)
+        return stats;
+
+    for (const Command& command : commands_)
+    {
+        switch (command.type)
+        {
+        case CommandType::Geometry:
+            // Vertex colors replace per-sprite texture modulation
+            if (command.texture)
+            {
+                SDL_SetTextureColorMod(command.texture, 255, 255, 255);
+                SDL_SetTextureAlphaMod(command.texture, 255);
+            }
+            SDL_RenderGeometry(renderer, command.texture, vertices_.data() + command.first,
+                               static_cast<int>(command.count), indices_.data() + command.firstIndex,
+                               static_cast<int>(command.indexCount));
+            ++stats.batches;
+            break;
+
+        case CommandType::Lines:
+            SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+            SDL_RenderDrawLinesF(renderer, points_.data() + command.first, static_cast<int>(command.count));
+            break;
+
+        case CommandType::Points:
+            SDL_SetRenderDrawColor(renderer, command.color.r, command.color.g, command.color.b, command.color.a);
+            SDL_RenderDrawPointsF(renderer, points_.data() + command.first, static_cast<int>(command.count));
+            break;
+        }
+        ++stats.drawCalls;
+    }
+    return stats;
+}
+
+RenderCommandList::Command& RenderCommandList::OpenGeometry(SDL_Texture* texture)
+{
+    if (!commands_.empty())
+    {
+        Command& last = commands_.back();
+        if (last.type == CommandType::Geometry && last.texture == texture)
+            return last;
+    }
+
+    Command command;
+    command.texture = texture;
+    command.first = static_cast<uint32_t>(vertices_.size());
+    command.firstIndex = static_cast<uint32_t>(indices_.size());
+    commands_.push_back(command);
+    return commands_.back();
+}
+
+const std::vector<SDL_FPoint>& RenderCommandList::GetRing(int segments)
+{
+    const size_t slot = static_cast<size_t>(segments / 4);
+    if (slot >= rings_.size())
+        rings_.resize(slot + 1);
+
+    std::vector<SDL_FPoint>& ring = rings_[slot];
+    if (ring.empty())
+    {
+        ring.resize(static_cast<size_t>(segments));
+        for (int i = 0; i < segments; ++i)
+        {
+            const float angle = 2.0f * kPi * static_cast<float>(i) / static_cast<float>(segments);
+            ring[static_cast<size_t>(i)] = {std::cos(angle), std::sin(angle)};
+        }
+    }
+    return ring;
+}
+
+} // namespace Axion
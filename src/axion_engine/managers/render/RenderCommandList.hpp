@@ -0,0 +1,121 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL.h>
+
+namespace Axion
+{
+
+/** @brief Counters of one RenderCommandList::Submit(). */
+struct SubmitStats
+{
+    size_t drawCalls = 0; ///< SDL draw calls issued
+    size_t batches = 0;   ///< SDL_RenderGeometry calls among them
+};
+
+/**
+ * @brief Flat list of draw commands, recorded without touching SDL.
+ *
+ * Renderables record screen-space geometry into the list during render
+ * preparation (IRenderable::Render()); Submit() later replays it through
+ * the SDL renderer. Recording does not call SDL, so it may run on a worker
+ * thread while another list is being submitted.
+ *
+ * Consecutive geometry that uses the same texture (or no texture) is merged
+ * into one command and submitted with a single SDL_RenderGeometry call.
+ * Lines and points (debug gizmos) are commands of their own, so draw order
+ * is preserved across kinds.
+ */
+class RenderCommandList
+{
+public:
+    /** @brief Drops every command; buffers keep their capacity. */
+    void Clear();
+
+    /**
+     * @brief Records a quad.
+     * @param texture Texture to sample, or nullptr for a solid quad
+     * @param positions Screen-space corners, in order around the quad
+     * @param uvs Normalized texture coordinates of the corners (ignored without texture)
+     * @param color Vertex color, multiplied with the texture
+     */
+    void AddQuad(SDL_Texture* texture, const SDL_FPoint (&positions)[4], const SDL_FPoint (&uvs)[4],
+                 const SDL_Color& color);
+
+    /**
+     * @brief Records indexed triangles.
+     * @param indices Indices into @p vertices
+     */
+    void AddTriangles(SDL_Texture* texture, const SDL_Vertex* vertices, int vertexCount, const int* indices,
+                      int indexCount);
+
+    /**
+     * @brief Records a solid circle as a triangle fan.
+     *
+     * The segment count follows the radius so the outline stays within a
+     * fraction of a pixel of a true circle; the unit ring of each segment
+     * count is computed once and reused.
+     *
+     * @param center Screen-space center
+     * @param radius Screen-space radius in pixels
+     */
+    void AddCircle(const SDL_FPoint& center, float radius, const SDL_Color& color);
+
+    /** @brief Records a polyline through @p count screen-space points. */
+    void AddLines(const SDL_FPoint* points, int count, const SDL_Color& color);
+
+    /** @brief Records @p count screen-space points. */
+    void AddPoints(const SDL_FPoint* points, int count, const SDL_Color& color);
+
+    /**
+     * @brief Replays the commands through @p renderer (main thread).
+     * @return Draw calls and batches issued
+     */
+    SubmitStats Submit(SDL_Renderer* renderer) const;
+
+    /** @brief Returns true if nothing was recorded since Clear(). */
+    bool IsEmpty() const { return commands_.empty(); }
+
+    /** @brief Returns the number of commands recorded since Clear(). */
+    size_t GetCommandCount() const { return commands_.size(); }
+
+    /** @brief Returns the quads and triangle groups recorded since Clear(). */
+    size_t GetBatchedCount() const { return batched_; }
+
+private:
+    enum class CommandType : uint8_t
+    {
+        Geometry,
+        Lines,
+        Points
+    };
+
+    struct Command
+    {
+        CommandType type = CommandType::Geometry;
+        SDL_Texture* texture = nullptr; // Geometry only
+        SDL_Color color{255, 255, 255, 255}; // Lines and points only
+        uint32_t first = 0;      // First vertex (geometry) or point
+        uint32_t count = 0;      // Vertices or points
+        uint32_t firstIndex = 0; // Geometry only
+        uint32_t indexCount = 0;
+    };
+
+    // Returns the geometry command @p texture joins, opening one if needed
+    Command& OpenGeometry(SDL_Texture* texture);
+
+    // Unit ring with @p segments points (a multiple of 4)
+    const std::vector<SDL_FPoint>& GetRing(int segments);
+
+    std::vector<Command> commands_;
+    std::vector<SDL_Vertex> vertices_;
+    std::vector<int> indices_; // Relative to their command's first vertex
+    std::vector<SDL_FPoint> points_;
+    std::vector<std::vector<SDL_FPoint>> rings_; // Indexed by segments / 4
+
+    size_t batched_ = 0;
+};
+
+} // namespace Axion
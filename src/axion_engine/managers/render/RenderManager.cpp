@@ -1,9 +1,21 @@
 #include "RenderManager.hpp"
 
+#include <algorithm>
+
+#include "axion_engine/managers/analysis/Analyzer.hpp"
+#include "axion_engine/core/jobs/JobSystem.hpp"
+
 namespace Axion
 {
 
-RenderManager::RenderManager(EngineContext& ctx) : ContextAware(ctx)
+namespace
+{
+
+constexpr size_t kRecordChunkSize = 512; // Renderables recorded into one command list
+
+} // namespace
+
+RenderManager::RenderManager(EngineContext& ctx) : ContextAware(ctx), staticLayer_(ctx)
 {
     INFO("RenderManager initialized.");
 }
@@ -18,9 +30,8 @@ void RenderManager::Update()
     if (!ctx_.render || !ctx_.scene)
         return;
 
+    // Without a renderer (HeadlessMode::NoRender) the frame is prepared but not drawn
     renderer_ = ctx_.window->GetRenderer();
-    if (!renderer_)
-        return;
 
     Scene* scene = ctx_.sceneProvider->GetCurrentScene();
     if (!scene)
@@ -30,25 +41,6 @@ void RenderManager::Update()
     if (!camera)
         return;
 
-    RenderContext rctx;
-    rctx.renderer = renderer_;
-    rctx.camera = camera;
-    SDL_GetRendererOutputSize(renderer_, &rctx.windowWidth, &rctx.windowHeight);
-
-    renderables.clear();
-    CollectRenderables(*scene, renderables);
-
-    std::sort(renderables.begin(), renderables.end(),
-              [](const IRenderable* a, const IRenderable* b)
-              {
-                  if (a->GetLayer() != b->GetLayer())
-                      return a->GetLayer() < b->GetLayer();
-                  return a->GetOrderInLayer() < b->GetOrderInLayer();
-              });
-
-    SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
-    SDL_RenderClear(renderer_);
-
     if (ctx_.inputProvider->IsKeyJustPressed(SDL_SCANCODE_F3))
     {
         debugMode_ = !debugMode_;
@@ -58,33 +50,92 @@ void RenderManager::Update()
             INFO("Debug Render Mode Disabled.");
     }
 
+    RenderContext rctx;
+    rctx.camera = camera;
+
+    // One world unit per pixel; renderables read the view from rctx instead of querying it
+    glm::ivec2 size = ctx_.window->GetSize();
+    if (renderer_)
+        SDL_GetRendererOutputSize(renderer_, &size.x, &size.y);
+    auto* camTr = camera->GetOwner()->GetTransform();
+    const glm::vec2 camPos = camTr ? glm::vec2(camTr->GetWorldPosition()) : glm::vec2(0.0f);
+    rctx.SetView(camPos, 1.0f, size.x, size.y);
+
+    RenderQueue& queue = scene->GetRenderQueue();
+    queue.Refresh();
+
+    RenderStats stats;
+    stats.culled = queue.Collect(rctx.viewMin, rctx.viewMax, renderables);
+    staticLayer_.Update(scene, queue, rctx, renderer_, renderables);
+    if (!debugMode_)
+        std::erase_if(renderables, [](IRenderable* r) { return r->GetLayer() == RenderLayer::Debug; });
+    stats.drawn = renderables.size();
+
+    // Resources are created here, on the main thread: recording may run on a worker
     for (IRenderable* r : renderables)
+        r->PrepareRender(ctx_);
+
+    if (renderer_)
     {
-        if (!debugMode_ && r->GetLayer() == RenderLayer::Debug)
-            continue;
-        r->Render(rctx);
+        SDL_SetRenderDrawColor(renderer_, 0, 0, 0, 255);
+        SDL_RenderClear(renderer_);
     }
-    SDL_RenderPresent(renderer_);
-}
 
-void RenderManager::CollectRenderables(Scene& scene, std::vector<IRenderable*>& out)
-{
-    out.clear();
+    // Chunk i + 1 is recorded on a worker while chunk i is submitted; without a job system, beforehand
+    const size_t count = renderables.size();
+    const size_t chunks = (count + kRecordChunkSize - 1) / kRecordChunkSize;
+    auto chunkEnd = [count](size_t chunk) { return std::min((chunk + 1) * kRecordChunkSize, count); };
+
+    if (chunks > 0)
+        Record(rctx, commandLists_[0], 0, chunkEnd(0));
 
-    for (GameObject* go : scene.GetGameObjects())
+    for (size_t chunk = 0; chunk < chunks; ++chunk)
     {
-        if (!go || !go->IsEnabled() || go->IsDestroyed())
-            continue;
+        JobCounter recorded;
+        const size_t next = chunk + 1;
+        if (next < chunks)
+        {
+            RenderCommandList& nextList = commandLists_[next % 2];
+            auto record = [this, &rctx, &nextList, next, &chunkEnd]
+            { Record(rctx, nextList, next * kRecordChunkSize, chunkEnd(next)); };
+            if (ctx_.jobs)
+                jobs().Submit(record, &recorded);
+            else
+                record();
+        }
 
-        const auto& components = go->GetAllComponents();
-        for (const auto& comp : components)
+        if (renderer_)
         {
-            if (auto* renderable = dynamic_cast<IRenderable*>(comp.get()))
-            {
-                out.push_back(renderable);
-            }
+            const SubmitStats submitted = commandLists_[chunk % 2].Submit(renderer_);
+            stats.drawCalls += submitted.drawCalls;
+            stats.batches += submitted.batches;
         }
+
+        if (ctx_.jobs)
+            jobs().Wait(recorded);
     }
+
+    if (ctx_.analyzer)
+        ctx_.analyzer->RecordRenderStats(stats);
+
+    if (renderer_)
+        SDL_RenderPresent(renderer_);
+}
+
+void RenderManager::ProcessEvent(const SDL_Event& event)
+{
+    if (event.type == SDL_RENDER_TARGETS_RESET || event.type == SDL_RENDER_DEVICE_RESET)
+        staticLayer_.InvalidateAll();
+}
+
+void RenderManager::Record(const RenderContext& rctx, RenderCommandList& list, size_t begin, size_t end)
+{
+    list.Clear();
+
+    RenderContext chunkCtx = rctx;
+    chunkCtx.commands = &list;
+    for (size_t i = begin; i < end; ++i)
+        renderables[i]->Render(chunkCtx);
 }
 
 } // namespace Axion
\ No newline at end of file
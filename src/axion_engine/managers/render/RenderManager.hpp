@@ -9,6 +9,11 @@
 #include "axion_engine/managers/scene/SceneManager.hpp"
 #include "axion_engine/managers/input/InputManager.hpp"
 #include "axion_engine/platform/window/Window.hpp"
+#include "axion_engine/managers/render/RenderCommandList.hpp"
+#include "axion_engine/managers/render/StaticLayer.hpp"
+
+#include <array>
+#include <vector>
 
 #include "axion_engine/runtime/components/renderer/RenderComponent.hpp"
 #include "axion_engine/runtime/components/renderer/SpriteRenderComponent.hpp"
@@ -19,8 +24,34 @@ namespace Axion
 /**
  * @brief Manages rendering of all visible objects in the scene.
  * 
- * RenderManager collects renderable components, sorts them by layer
- * and order, and renders them to the screen using SDL2.
+ * RenderManager draws the current scene's RenderQueue: renderables are
+ * registered with the scene when mounted and kept sorted by layer and
+ * order, so each frame only refreshes what changed and collects what the
+ * camera sees.
+ *
+ * Each frame is split into a preparation and a submission phase.
+ * Preparation runs each visible renderable's Render(), which records
+ * screen-space geometry into a RenderCommandList without touching SDL;
+ * submission replays the list through the renderer, one
+ * SDL_RenderGeometry call per run of equal texture. Renderables are
+ * recorded in chunks into two alternating lists, so a worker records the
+ * next chunk while the main thread submits the current one (chunks hold
+ * 512 renderables, so smaller frames do not overlap; without a job system
+ * every chunk is recorded on the main thread). SDL resources
+ * are created beforehand on the main thread (IRenderable::PrepareRender()).
+ * Draw call and batch counts are reported to the Analyzer every frame.
+ *
+ * Renderables whose world bounds (IRenderable::GetWorldBounds()) lie
+ * entirely outside the camera's view are culled through the queue's
+ * quadtree; drawn and culled counts are reported alongside.
+ *
+ * Static renderables (RenderComponent::SetStatic()) are not recorded every
+ * frame: the StaticLayer bakes them into chunk textures and each visible
+ * chunk is drawn as a single quad.
+ *
+ * Without a renderer (HeadlessMode::NoRender) the queue is still refreshed,
+ * culled and recorded every frame, so render preparation can be
+ * benchmarked; only submission is skipped.
  * 
  * @par Render Layers:
  * - Background (0)
@@ -38,11 +69,23 @@ public:
     /** @brief Renders all visible objects in the current scene. */
     void Update();
 
+    /**
+     * @brief Handles renderer events.
+     *
+     * Re-bakes the static layer when SDL reports that render target
+     * contents were lost (SDL_RENDER_TARGETS_RESET, SDL_RENDER_DEVICE_RESET).
+     */
+    void ProcessEvent(const SDL_Event& event);
+
 private:
-    std::vector<IRenderable*> renderables;
-    void CollectRenderables(Scene& scene, std::vector<IRenderable*>& out);
+    // Records renderables [begin, end) into list (any thread)
+    void Record(const RenderContext& rctx, RenderCommandList& list, size_t begin, size_t end);
+
+    std::vector<IRenderable*> renderables; // Visible this frame, in draw order
 
     SDL_Renderer* renderer_;
+    std::array<RenderCommandList, 2> commandLists_; // One is submitted while the other is recorded
+    StaticLayer staticLayer_;
     bool debugMode_ = false;
 };
 
@@ -0,0 +1,207 @@
+#include "StaticLayer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Axion
+{
+
+namespace
+{
+
+constexpr int kChunkSize = 512;         // Chunk side in world units and texture pixels (baked at zoom 1)
+constexpr uint32_t kEvictFrames = 300;  // Frames off-screen after which a chunk's texture is released
+
+} // namespace
+
+StaticLayer::~StaticLayer()
+{
+    Clear();
+}
+
+void StaticLayer::Update(const Scene* scene, RenderQueue& queue, const RenderContext& view, SDL_Renderer* renderer,
+                         std::vector<IRenderable*>& renderables)
+{
+    if (++frame_ == 0)
+        ++frame_;
+
+    const bool reset = queue.TakeStaticChanges(changes_);
+    if (scene != scene_ || reset)
+    {
+        Clear();
+        scene_ = scene;
+    }
+    glm::vec2 worldMin, worldMax;
+    queue.GetBounds(worldMin, worldMax);
+    for (const StaticArea& area : changes_)
+        Invalidate(area, worldMin, worldMax);
+
+    visible_.clear();
+    for (auto it = chunks_.begin(); it != chunks_.end();)
+    {
+        Chunk& chunk = it->second;
+        const bool onScreen = chunk.max.x > view.viewMin.x && chunk.min.x < view.viewMax.x &&
+                              chunk.max.y > view.viewMin.y && chunk.min.y < view.viewMax.y;
+
+        if (!onScreen)
+        {
+            if (chunk.texture && frame_ - chunk.lastVisibleFrame > kEvictFrames)
+            {
+                SDL_DestroyTexture(chunk.texture);
+                chunk.texture = nullptr;
+                chunk.dirty = true;
+            }
+            ++it;
+            continue;
+        }
+
+        chunk.lastVisibleFrame = frame_;
+        if (chunk.dirty && renderer && !Bake(chunk, queue, view, renderer))
+        {
+            if (chunk.texture)
+                SDL_DestroyTexture(chunk.texture);
+            it = chunks_.erase(it);
+            continue;
+        }
+
+        if (chunk.texture && !chunk.dirty)
+            visible_.push_back(&chunk);
+        ++it;
+    }
+
+    if (visible_.empty())
+        return;
+
+    // Each chunk goes before the first renderable of its layer or above
+    std::sort(visible_.begin(), visible_.end(), [](const Chunk* a, const Chunk* b) {
+        return static_cast<int>(a->layer) < static_cast<int>(b->layer);
+    });
+
+    merged_.clear();
+    size_t next = 0;
+    for (IRenderable* renderable : renderables)
+    {
+        const int layer = static_cast<int>(renderable->GetLayer());
+        while (next < visible_.size() && static_cast<int>(visible_[next]->layer) <= layer)
+            merged_.push_back(visible_[next++]);
+        merged_.push_back(renderable);
+    }
+    merged_.insert(merged_.end(), visible_.begin() + static_cast<std::ptrdiff_t>(next), visible_.end());
+    renderables.swap(merged_);
+}
+
+void StaticLayer::Clear()
+{
+    for (auto& [key, chunk] : chunks_)
+    {
+        if (chunk.texture)
+            SDL_DestroyTexture(chunk.texture);
+    }
+    chunks_.clear();
+}
+
+void StaticLayer::InvalidateAll()
+{
+    for (auto& [key, chunk] : chunks_)
+        chunk.dirty = true;
+}
+
+uint64_t StaticLayer::MakeKey(RenderLayer layer, int x, int y)
+{
+    constexpr uint64_t kCoordMask = (1ull << 26) - 1;
+    return static_cast<uint64_t>(layer) << 52 | (static_cast<uint64_t>(x) & kCoordMask) << 26 |
+           (static_cast<uint64_t>(y) & kCoordMask);
+}
+
+void StaticLayer::Invalidate(const StaticArea& area, const glm::vec2& worldMin, const glm::vec2& worldMax)
+{
+    // Old areas may lie outside bounds that shrank since; they have no chunks left to redraw
+    const glm::vec2 min = glm::max(area.min, worldMin);
+    const glm::vec2 max = glm::min(area.max, worldMax);
+    if (min.x > max.x || min.y > max.y)
+        return;
+
+    const int minX = static_cast<int>(std::floor(min.x / kChunkSize));
+    const int minY = static_cast<int>(std::floor(min.y / kChunkSize));
+    const int maxX = static_cast<int>(std::floor(max.x / kChunkSize));
+    const int maxY = static_cast<int>(std::floor(max.y / kChunkSize));
+
+    for (int y = minY; y <= maxY; ++y)
+    {
+        for (int x = minX; x <= maxX; ++x)
+        {
+            auto [it, inserted] = chunks_.try_emplace(MakeKey(area.layer, x, y));
+            Chunk& chunk = it->second;
+            if (inserted)
+            {
+                chunk.layer = area.layer;
+                chunk.min = glm::vec2(static_cast<float>(x * kChunkSize), static_cast<float>(y * kChunkSize));
+                chunk.max = chunk.min + glm::vec2(static_cast<float>(kChunkSize));
+            }
+            chunk.dirty = true;
+        }
+    }
+}
+
+bool StaticLayer::Bake(Chunk& chunk, RenderQueue& queue, const RenderContext& view, SDL_Renderer* renderer)
+{
+    queue.CollectStatic(chunk.layer, chunk.min, chunk.max, baking_);
+    if (baking_.empty())
+        return false;
+
+    if (!chunk.texture)
+    {
+        chunk.texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, kChunkSize,
+                                          kChunkSize);
+        if (!chunk.texture)
+        {
+            // Stays dirty and is retried; its renderables are not drawn meanwhile
+            WARN("Could not create a static chunk texture: {}", SDL_GetError());
+            return true;
+        }
+        SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_BLEND);
+    }
+
+    for (IRenderable* renderable : baking_)
+        renderable->PrepareRender(ctx_);
+
+    // The chunk is recorded like a screen of its own size centered on it
+    RenderContext bakeCtx;
+    bakeCtx.camera = view.camera;
+    bakeCtx.SetView((chunk.min + chunk.max) * 0.5f, 1.0f, kChunkSize, kChunkSize);
+    bakeCtx.commands = &bakeList_;
+
+    bakeList_.Clear();
+    for (IRenderable* renderable : baking_)
+        renderable->Render(bakeCtx);
+
+    SDL_Texture* previous = SDL_GetRenderTarget(renderer);
+    SDL_SetRenderTarget(renderer, chunk.texture);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+    SDL_RenderClear(renderer);
+    bakeList_.Submit(renderer);
+    SDL_SetRenderTarget(renderer, previous);
+
+    chunk.dirty = false;
+    return true;
+}
+
+void StaticLayer::Chunk::Render(const RenderContext& ctx)
+{
+    if (!ctx.commands)
+        return;
+
+    // Texture row 0 holds the top (max Y) edge of the chunk
+    const glm::vec2 corners[4] = {
+        ctx.WorldToScreen({min.x, max.y}), ctx.WorldToScreen({max.x, max.y}),
+        ctx.WorldToScreen({max.x, min.y}), ctx.WorldToScreen({min.x, min.y})};
+
+    SDL_FPoint positions[4];
+    for (int i = 0; i < 4; ++i)
+        positions[i] = {corners[i].x, corners[i].y};
+
+    const SDL_FPoint uvs[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+    ctx.commands->AddQuad(texture, positions, uvs, SDL_Color{255, 255, 255, 255});
+}
+
+} // namespace Axion
@@ -0,0 +1,104 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include "axion_engine/structure/ContextAware.hpp"
+#include "axion_engine/managers/render/RenderCommandList.hpp"
+#include "axion_engine/runtime/classes/scene/RenderQueue.hpp"
+#include "axion_engine/runtime/interfaces/IRenderable.hpp"
+
+namespace Axion
+{
+
+class Scene;
+
+/**
+ * @brief Caches static renderables in chunked render-target textures.
+ *
+ * The world is divided, per render layer, into square chunks. A chunk is
+ * baked by recording the static renderables overlapping it
+ * (RenderQueue::CollectStatic()) and submitting them into its own texture
+ * through SDL_SetRenderTarget(). It is baked again only when a static area
+ * reported by RenderQueue::TakeStaticChanges() overlaps it, so unchanged
+ * scenery costs one quad per visible chunk and frame however many
+ * renderables it holds.
+ *
+ * Visible chunks are inserted into the frame's draw list at the start of
+ * their layer, as ordinary renderables recording one textured quad.
+ * Textures of chunks that stay off-screen for a while are released and
+ * baked again when they come back into view. Nothing is baked without a
+ * renderer (HeadlessMode::NoRender).
+ *
+ * @note Main thread only.
+ */
+class StaticLayer : public ContextAware
+{
+public:
+    explicit StaticLayer(EngineContext& ctx) : ContextAware(ctx) {}
+    ~StaticLayer();
+
+    StaticLayer(const StaticLayer&) = delete;
+    StaticLayer& operator=(const StaticLayer&) = delete;
+
+    /**
+     * @brief Bakes what changed and inserts the visible chunks into the draw list.
+     * @param scene Scene owning @p queue; chunks are dropped when it changes
+     * @param queue Render queue of @p scene, already refreshed
+     * @param view Frame view
+     * @param renderer Renderer to bake with, or nullptr
+     * @param renderables Draw list in draw order; chunks are inserted into it
+     */
+    void Update(const Scene* scene, RenderQueue& queue, const RenderContext& view, SDL_Renderer* renderer,
+                std::vector<IRenderable*>& renderables);
+
+    /** @brief Destroys every chunk texture. */
+    void Clear();
+
+    /** @brief Bakes every chunk again when next visible (render targets were lost). */
+    void InvalidateAll();
+
+    /** @brief Returns the number of chunks holding static renderables. */
+    size_t GetChunkCount() const { return chunks_.size(); }
+
+private:
+    class Chunk final : public IRenderable
+    {
+    public:
+        RenderLayer GetLayer() const override { return layer; }
+        int GetOrderInLayer() const override { return INT32_MIN; }
+        SDL_Texture* GetBatchTexture() const override { return texture; }
+        void Render(const RenderContext& ctx) override;
+
+        RenderLayer layer = RenderLayer::Default;
+        glm::vec2 min{0.0f};
+        glm::vec2 max{0.0f};
+        SDL_Texture* texture = nullptr;
+        uint32_t lastVisibleFrame = 0;
+        bool dirty = true;
+    };
+
+    static uint64_t MakeKey(RenderLayer layer, int x, int y);
+
+    // Marks the chunks of an area dirty, creating missing ones; only cells inside the world bounds are kept
+    void Invalidate(const StaticArea& area, const glm::vec2& worldMin, const glm::vec2& worldMax);
+
+    // Redraws a chunk; false if no static renderable overlaps it anymore
+    bool Bake(Chunk& chunk, RenderQueue& queue, const RenderContext& view, SDL_Renderer* renderer);
+
+    std::unordered_map<uint64_t, Chunk> chunks_;
+    const Scene* scene_ = nullptr;
+    uint32_t frame_ = 0;
+
+    std::vector<StaticArea> changes_;
+    std::vector<Chunk*> visible_;
+    std::vector<IRenderable*> baking_;
+    std::vector<IRenderable*> merged_;
+    RenderCommandList bakeList_;
+};
+
+} // namespace Axion
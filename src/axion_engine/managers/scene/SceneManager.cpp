@@ -1,5 +1,8 @@
 #include "SceneManager.hpp"
 
+#include <algorithm>
+#include <chrono>
+
 namespace Axion
 {
 
@@ -19,6 +22,7 @@ void SceneManager::Update()
     {
         float dt = ctx_.timeProvider->GetDeltaTime();
         currentScene_->Tick();
+        currentScene_->UpdateTransforms();
     }
 }
 
@@ -41,6 +45,66 @@ void SceneManager::ProcessRequests()
         sceneChangeRequests_.pop();
         ChangeScene(next);
     }
+
+    ProcessBackgroundScenes();
+}
+
+void SceneManager::Preload(std::string sceneName)
+{
+    if (!IsSceneRegistered(sceneName))
+    {
+        WARN("Scene '{}' is not registered. Cannot preload scene.", sceneName.c_str());
+        return;
+    }
+
+    Scene* scene = scenes_[sceneName].get();
+    if (scene == currentScene_)
+        return;
+
+    tearingDown_.erase(std::remove(tearingDown_.begin(), tearingDown_.end(), scene), tearingDown_.end());
+    scene->BeginPreload();
+    if (scene->loadState_ == Scene::LoadState::Preloading &&
+        std::find(preloading_.begin(), preloading_.end(), scene) == preloading_.end())
+    {
+        INFO("Preloading scene: {}", sceneName.c_str());
+        preloading_.push_back(scene);
+    }
+}
+
+bool SceneManager::IsPreloaded(const std::string& sceneName) const
+{
+    auto it = scenes_.find(sceneName);
+    return it != scenes_.end() && it->second->loadState_ == Scene::LoadState::Preloaded;
+}
+
+void SceneManager::ProcessBackgroundScenes()
+{
+    // Scenes whose images are decoded get their objects built
+    preloading_.erase(std::remove_if(preloading_.begin(), preloading_.end(),
+                                     [](Scene* scene) { return scene->UpdatePreload(false); }),
+                      preloading_.end());
+
+    if (tearingDown_.empty())
+        return;
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<float, std::milli>(teardownBudgetMs_));
+
+    while (!tearingDown_.empty())
+    {
+        Scene* scene = tearingDown_.front();
+        if (scene->loadState_ == Scene::LoadState::TearingDown && !scene->TeardownStep(deadline))
+            return;
+        tearingDown_.erase(tearingDown_.begin());
+    }
+}
+
+void SceneManager::SetScriptBudget(float milliseconds)
+{
+    scriptBudgetMs_ = milliseconds;
+    for (auto& [name, scene] : scenes_)
+        scene->SetScriptBudget(milliseconds);
 }
 
 bool SceneManager::IsSceneRegistered(std::string sceneName) const
@@ -57,18 +121,25 @@ void SceneManager::ChangeScene(std::string sceneName)
     }
 
     INFO("Changing to scene: {}", sceneName.c_str());
-    
+
+    Scene* next = scenes_[sceneName].get();
+
     if (currentScene_)
     {
         currentScene_->Exit();
-    }
 
-    if (currentSceneName_ == sceneName && currentScene_)
-    {
-        currentScene_->ClearAllObjects();
+        // Restarting a scene needs its objects gone before it enters again
+        if (currentScene_ == next)
+            currentScene_->FinishTeardown();
+        else
+            tearingDown_.push_back(currentScene_);
     }
 
-    currentScene_ = scenes_[sceneName].get();
+    // Enter() completes any pending preload or teardown of the scene itself
+    tearingDown_.erase(std::remove(tearingDown_.begin(), tearingDown_.end(), next), tearingDown_.end());
+    preloading_.erase(std::remove(preloading_.begin(), preloading_.end(), next), preloading_.end());
+
+    currentScene_ = next;
     currentSceneName_ = sceneName;
 
     currentScene_->Enter();
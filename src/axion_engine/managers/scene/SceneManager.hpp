@@ -4,6 +4,7 @@
 #include <string>
 #include <unordered_map>
 #include <queue>
+#include <vector>
 
 #include "axion_engine/structure/ContextAware.hpp"
 #include "axion_engine/core/EngineContext.hpp"
@@ -30,11 +31,19 @@ enum class SceneManagerState
  * SceneManager handles scene registration, loading, and transitions.
  * It supports deferred scene changes to ensure safe transitions during
  * the game loop.
+ *
+ * Transitions avoid single-frame hitches: a scene can be preloaded while
+ * another one runs (textures decoded on the JobSystem, objects built and
+ * mounted once they are ready), so changing to it only swaps the current
+ * pointer. The scene left behind is released a few objects at a time, within
+ * a per-frame budget (see SetTeardownBudget()).
  * 
  * @par Usage:
  * @code
  * sceneManager->RegisterScene<MyScene>("Main");
+ * sceneManager->RegisterScene<LevelScene>("Level");
  * sceneManager->RequestChange("Main");
+ * sceneManager->Preload("Level"); // later: RequestChange("Level") is instant
  * @endcode
  */
 class SceneManager : public ContextAware, public ISceneProvider
@@ -52,6 +61,37 @@ public:
      */
     void RequestChange(std::string sceneName) override;
 
+    /**
+     * @brief Starts preloading a scene in the background.
+     *
+     * Runs the scene's OnScenePreload() now; once the textures it requested
+     * are decoded, OnSceneEnter() runs and its objects are mounted, all
+     * while the current scene keeps running. Changing to a scene still
+     * preloading finishes the work on the spot.
+     *
+     * @param sceneName Name of the registered scene to preload
+     */
+    void Preload(std::string sceneName) override;
+
+    /**
+     * @brief Checks if a scene is built and ready to become current.
+     * @param sceneName Name of the scene
+     * @return True once a preload of the scene has completed
+     */
+    bool IsPreloaded(const std::string& sceneName) const;
+
+    /**
+     * @brief Sets the main-thread time spent releasing previous scenes each frame.
+     * @param milliseconds Budget per frame; at least a few objects are released every frame
+     */
+    void SetTeardownBudget(float milliseconds) { teardownBudgetMs_ = milliseconds; }
+
+    /**
+     * @brief Sets the script budget of every registered scene and of scenes registered later.
+     * @param milliseconds Budget per frame for budgeted scripts (see Scene::SetScriptBudget())
+     */
+    void SetScriptBudget(float milliseconds);
+
     /** @brief Processes pending scene change requests and object queues. */
     void ProcessRequests();
 
@@ -77,12 +117,18 @@ public:
 
 private:
     void ChangeScene(std::string sceneName);
+    void ProcessBackgroundScenes();
 
     std::unordered_map<std::string, std::unique_ptr<Scene>> scenes_;
     Scene* currentScene_ = nullptr;
     std::string currentSceneName_;
 
     std::queue<std::string> sceneChangeRequests_;
+
+    std::vector<Scene*> preloading_;
+    std::vector<Scene*> tearingDown_;
+    float teardownBudgetMs_ = 1.0f;
+    float scriptBudgetMs_ = 1.0f;
 };
 
 template <typename TScene, typename... Args>
@@ -90,9 +136,11 @@ inline void SceneManager::RegisterScene(const std::string& sceneName, Args&&...
 {
     static_assert(std::is_base_of_v<Scene, TScene>, "TScene must derive from Scene");
 
-    scenes_[sceneName] = std::make_unique<TScene>(
+    auto scene = std::make_unique<TScene>(
         ctx_,
         std::forward<Args>(args)...);
+    scene->SetScriptBudget(scriptBudgetMs_);
+    scenes_[sceneName] = std::move(scene);
 }
 
 } // namespace Axion
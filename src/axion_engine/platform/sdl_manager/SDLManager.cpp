@@ -13,13 +13,14 @@ SDLManager::~SDLManager()
     QuitSDL();
 }
 
-void SDLManager::InitSDL()
+void SDLManager::InitSDL(bool video)
 {
     if (initialized_)
         return;
 
     // Initialize SDL
-    if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS | SDL_INIT_TIMER) < 0)
+    const Uint32 subsystems = SDL_INIT_EVENTS | SDL_INIT_TIMER | (video ? SDL_INIT_VIDEO : 0u);
+    if (SDL_Init(subsystems) < 0)
     {
         ERROR("SDL could not initialize! SDL_Error: %s\n", SDL_GetError());
         return;
@@ -21,8 +21,11 @@ public:
     SDLManager(EngineContext& ctx);
     ~SDLManager();
 
-    /** @brief Initializes SDL and related libraries. */
-    void InitSDL();
+    /**
+     * @brief Initializes SDL and related libraries.
+     * @param video False to skip the video subsystem (headless windows need no display)
+     */
+    void InitSDL(bool video = true);
     
     /** @brief Shuts down SDL and releases resources. */
     void QuitSDL();
@@ -1,5 +1,7 @@
 #include "Window.hpp"
 
+#include <algorithm>
+
 namespace Axion
 {
 
@@ -36,6 +38,11 @@ void Window::RestartWindow(const WindowConfig &config)
 
 bool Window::Initialize(const WindowConfig &config)
 {
+    headless_ = config.headless;
+    size_ = config.size;
+    if (config.headless != HeadlessMode::Disabled)
+        return InitializeHeadless(config);
+
     auto newWindow = CreateWindow(config);
     if (!newWindow)
     {
@@ -61,13 +68,61 @@ bool Window::Initialize(const WindowConfig &config)
     return true;
 }
 
+bool Window::InitializeHeadless(const WindowConfig &config)
+{
+    if (config.headless == HeadlessMode::NoRender)
+    {
+        INFO("Headless mode: rendering disabled.");
+        initialized_ = true;
+        return true;
+    }
+
+    // Software rendering into memory needs no video driver
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, std::max(config.size.x, 1), std::max(config.size.y, 1),
+                                                          32, SDL_PIXELFORMAT_RGBA32);
+    if (!surface)
+    {
+        ERROR("Offscreen surface could not be created! SDL_Error: {}", SDL_GetError());
+        return false;
+    }
+
+    SDL_Renderer *renderer = SDL_CreateSoftwareRenderer(surface);
+    if (!renderer)
+    {
+        ERROR("Could not create software renderer! SDL_Error: {}", SDL_GetError());
+        SDL_FreeSurface(surface);
+        return false;
+    }
+
+    surface_.reset(surface);
+    renderer_ = renderer;
+    INFO("Headless mode: rendering offscreen at {}x{}.", surface->w, surface->h);
+
+    initialized_ = true;
+    return true;
+}
+
 void Window::Reset() noexcept
 {
+    // SDL_DestroyWindow releases a window's renderer, but not one drawing into a surface
+    if (surface_ && renderer_)
+        SDL_DestroyRenderer(renderer_);
+    surface_.reset();
     window_.reset();
     renderer_ = nullptr;
     initialized_ = false;
 }
 
+glm::ivec2 Window::GetSize() const
+{
+    glm::ivec2 size = size_;
+    if (window_)
+        SDL_GetWindowSize(window_.get(), &size.x, &size.y);
+    else if (surface_)
+        size = {surface_->w, surface_->h};
+    return size;
+}
+
 SDL_Window *Window::CreateWindow(const WindowConfig &config) noexcept
 {
     SDL_Window *win = SDL_CreateWindow(
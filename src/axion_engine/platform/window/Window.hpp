@@ -16,6 +16,11 @@ namespace Axion
  * Window encapsulates SDL window creation, management, and destruction.
  * It provides access to the underlying SDL_Window and SDL_Renderer for
  * rendering operations.
+ *
+ * In headless mode (WindowConfig::headless) no SDL window exists:
+ * HeadlessMode::Offscreen renders through a software renderer into an
+ * in-memory surface of WindowConfig::size, HeadlessMode::NoRender has no
+ * renderer at all. Use GetSize() rather than the SDL window for the size.
  */
 class Window : public ContextAware
 {
@@ -39,12 +44,24 @@ public:
      */
     void RestartWindow(const WindowConfig& config);
 
-    /** @brief Returns the underlying SDL window handle. */
+    /** @brief Returns the underlying SDL window handle (nullptr when headless). */
     SDL_Window* GetSDLWindow() const { return window_.get(); }
     
-    /** @brief Returns the SDL renderer for this window. */
+    /** @brief Returns the SDL renderer for this window (nullptr in HeadlessMode::NoRender). */
     SDL_Renderer* GetRenderer() const { return renderer_; }
 
+    /** @brief Returns the surface offscreen frames are rendered into (nullptr unless HeadlessMode::Offscreen). */
+    SDL_Surface* GetOffscreenSurface() const { return surface_.get(); }
+
+    /** @brief Returns the headless mode the window was created with. */
+    HeadlessMode GetHeadlessMode() const { return headless_; }
+
+    /** @brief Returns true if there is no SDL window. */
+    bool IsHeadless() const { return headless_ != HeadlessMode::Disabled; }
+
+    /** @brief Returns the drawable size in pixels (the configured size when headless). */
+    glm::ivec2 GetSize() const;
+
 private:
     struct SDL_WindowDeleter
     {
@@ -55,11 +72,24 @@ private:
         }
     };
     
+    struct SDL_SurfaceDeleter
+    {
+        void operator()(SDL_Surface* ptr) const noexcept
+        {
+            if (ptr)
+                SDL_FreeSurface(ptr);
+        }
+    };
+    
     std::unique_ptr<SDL_Window, SDL_WindowDeleter> window_{nullptr};
+    std::unique_ptr<SDL_Surface, SDL_SurfaceDeleter> surface_{nullptr}; // Offscreen target
     SDL_Renderer* renderer_ = nullptr;
+    HeadlessMode headless_ = HeadlessMode::Disabled;
+    glm::ivec2 size_{0, 0}; // Configured size, reported when headless
     bool initialized_ = false;
 
     bool Initialize(const WindowConfig& config);
+    bool InitializeHeadless(const WindowConfig& config);
     void Reset() noexcept;
     SDL_Window* CreateWindow(const WindowConfig& config) noexcept;
     SDL_Renderer* CreateRenderer(SDL_Window* window) noexcept;
@@ -7,6 +7,16 @@
 namespace Axion
 {
 
+/**
+ * @brief Headless operation, for machines without a display (CI, servers).
+ */
+enum class HeadlessMode
+{
+    Disabled,  ///< Regular SDL window with an accelerated renderer
+    Offscreen, ///< No window; frames are rendered into an in-memory software surface
+    NoRender   ///< No window and no renderer; only render preparation runs
+};
+
 /**
  * @brief Configuration structure for window creation.
  * 
@@ -27,12 +37,16 @@ struct WindowConfig
     /** @brief SDL window creation flags (SDL_WINDOW_SHOWN, SDL_WINDOW_RESIZABLE, etc.). */
     Uint32 flags = SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE;
 
+    /** @brief Headless mode; when enabled, no window is created and @c flags and @c position are ignored. */
+    HeadlessMode headless = HeadlessMode::Disabled;
+
     bool operator==(const WindowConfig& other) const
     {
         return position == other.position &&
                size == other.size &&
                title == other.title &&
-               flags == other.flags;
+               flags == other.flags &&
+               headless == other.headless;
     }
 };
 
@@ -4,70 +4,22 @@
 namespace Axion
 {
 
-size_t GameObject::nextId_ = 0;
+std::atomic<size_t> GameObject::nextId_{0};
 
 GameObject::GameObject(Scene& parentScene) : parentScene_(parentScene), id_(nextId_++)
 {
     transform_ = AddComponent<TransformComponent>();
 }
 
-void GameObject::Tick()
+GameObject::GameObject(Scene& parentScene, NoTransformTag)
+    : parentScene_(parentScene), transform_(nullptr), id_(nextId_++)
 {
-    if (!isEnabled_ || isDestroyed_)
-        return;
-
-    if (isFirstUpdate_)
-    {
-        for (auto& component : components_)
-        {
-            if (isDestroyed_)
-                return;
-            if (!component)
-                continue;
-            if (auto updatable = dynamic_cast<IUpdateable*>(component.get()))
-            {
-                updatable->Start(ctx_());
-            }
-        }
-        isFirstUpdate_ = false;
-    }
-    else
-    {
-        for (auto& component : components_)
-        {
-            if (isDestroyed_)
-                return;
-            if (!component)
-                continue;
-            if (auto updatable = dynamic_cast<IUpdateable*>(component.get()))
-            {
-                updatable->Update(ctx_());
-            }
-        }
-    }
-}
-
-void GameObject::FixedUpdate()
-{
-    if (!isEnabled_ || isDestroyed_)
-        return;
-        
-    for (auto &component : components_)
-    {
-        if (isDestroyed_) // Check if destroyed during FixedUpdate()
-            return;
-        if (!component)
-            continue;
-        if (auto updatable = dynamic_cast<IUpdateable *>(component.get()))
-        {
-            updatable->FixedUpdate(ctx_());
-        }
-    }
 }
 
 void GameObject::Mounted()
 {
     isDestroyed_ = false;
+    isMounted_ = true;
     for (auto &component : components_)
     {
         component->OnMounted(ctx_());
@@ -99,9 +51,18 @@ void GameObject::Enable()
     if (isEnabled_)
         return;
     isEnabled_ = true;
+
+    // Components disabled on their own stay inactive; only types that
+    // override the callbacks are called
+    UpdateBuckets &buckets = parentScene_.updateBuckets_;
     for (auto &component : components_)
     {
-        component->OnEnabled(ctx_());
+        if (!component->enabled_)
+            continue;
+        buckets.SetActive(*component, true);
+        component->MarkRenderDirty(); // Static renderables are re-baked with it
+        if (component->enableCallbacks_)
+            component->OnEnabled(ctx_());
     }
 }
 
@@ -110,9 +71,16 @@ void GameObject::Disable()
     if (!isEnabled_)
         return;
     isEnabled_ = false;
+
+    UpdateBuckets &buckets = parentScene_.updateBuckets_;
     for (auto &component : components_)
     {
-        component->OnDisabled(ctx_());
+        if (!component->enabled_)
+            continue;
+        buckets.SetActive(*component, false);
+        component->MarkRenderDirty();
+        if (component->enableCallbacks_)
+            component->OnDisabled(ctx_());
     }
 }
 
@@ -188,6 +156,77 @@ void GameObject::OnTriggerExit(GameObject &other)
     }
 }
 
+void GameObject::SetName(std::string_view name)
+{
+    const NameId newId = NameRegistry::Intern(name);
+    if (newId == nameId_)
+        return;
+
+    const NameId oldId = nameId_;
+    nameId_ = newId;
+    if (isMounted_ && !isDestroyed_)
+        parentScene_.OnNameChanged(*this, oldId);
+}
+
+void GameObject::SetTag(std::string_view tag)
+{
+    const NameId newId = NameRegistry::Intern(tag);
+    if (newId == tagId_)
+        return;
+
+    const NameId oldId = tagId_;
+    tagId_ = newId;
+    if (isMounted_ && !isDestroyed_)
+        parentScene_.OnTagChanged(*this, oldId);
+}
+
+void GameObject::SetParent(GameObject* parent)
+{
+    if (parent == parent_ || parent == this)
+        return;
+
+    if (parent)
+    {
+        if (&parent->parentScene_ != &parentScene_)
+        {
+            ctx_().logger->Warn("GameObject {} cannot be parented to an object of another scene.", id_);
+            return;
+        }
+        if (parent->transform_->IsDescendantOf(transform_))
+        {
+            ctx_().logger->Warn("GameObject {} cannot be parented to its own descendant.", id_);
+            return;
+        }
+    }
+
+    if (parent_)
+    {
+        auto& siblings = parent_->children_;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+    }
+
+    parent_ = parent;
+    if (parent_)
+        parent_->children_.push_back(this);
+
+    transform_->SetParent(parent_ ? parent_->transform_ : nullptr);
+    parentScene_.hierarchy_.MarkStructureDirty();
+}
+
+void GameObject::DetachFromHierarchy()
+{
+    SetParent(nullptr);
+
+    // Orphan the children; the ones being destroyed with us are already queued
+    for (GameObject* child : children_)
+    {
+        child->parent_ = nullptr;
+        child->transform_->SetParent(nullptr);
+    }
+    children_.clear();
+    parentScene_.hierarchy_.MarkStructureDirty();
+}
+
 bool GameObject::HasCollider() const
 { // TODO: Check if this is the most efficient way, maybe store a bool that is updated when adding/removing components?
     for (const auto &comp : components_)
@@ -200,6 +239,45 @@ bool GameObject::HasCollider() const
     return false;
 }
 
+void GameObject::AdoptComponent(ComponentPtr component)
+{
+    component->Bind(this);
+    if (components_.empty())
+        transform_ = static_cast<TransformComponent*>(component.get());
+
+    components_.push_back(std::move(component));
+    if (isMounted_)
+        RegisterComponent(*components_.back());
+}
+
+void GameObject::RegisterComponent(Component& component)
+{
+    parentScene_.RegisterComponent(component);
+}
+
+void GameObject::OnUpdateFrequencyChanged(ScriptableComponent& script)
+{
+    parentScene_.updateBuckets_.RefreshBudgeted(script);
+}
+
+void GameObject::OnRenderableChanged(Component& component)
+{
+    parentScene_.renderQueue_.MarkDirty(component);
+}
+
+void GameObject::OnComponentToggled(Component& component)
+{
+    parentScene_.updateBuckets_.SetActive(component, component.enabled_);
+    component.MarkRenderDirty();
+    if (!component.enableCallbacks_)
+        return;
+
+    if (component.enabled_)
+        component.OnEnabled(ctx_());
+    else
+        component.OnDisabled(ctx_());
+}
+
 EngineContext& GameObject::ctx_()
 {
     return parentScene_.GetContext();
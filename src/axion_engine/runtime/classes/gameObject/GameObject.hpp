@@ -1,6 +1,9 @@
 #pragma once
+#include <atomic>
 #include <vector>
 #include <memory>
+#include <string>
+#include <string_view>
 
 #include "axion_engine/structure/ContextAware.hpp"
 #include "axion_engine/core/EngineContext.hpp"
@@ -9,11 +12,15 @@
 #include "axion_engine/runtime/components/Component.hpp"
 #include "axion_engine/runtime/components/transform/TransformComponent.hpp"
 #include "axion_engine/runtime/components/collider/ColliderComponent.hpp"
+#include "NameRegistry.hpp"
+#include "axion_utilities/spatial/LooseQuadtree.hpp"
 
 namespace Axion
 {
 
 class Scene;
+class ObjectPool;
+class ScriptableComponent;
 
 /**
  * @brief Base entity class that exists within a Scene.
@@ -27,7 +34,14 @@ class Scene;
  * go->GetTransform()->SetPosition({100, 200, 0});
  * auto sprite = go->AddComponent<SpriteRenderComponent>();
  * sprite->SetTexture(myTexture);
+ * go->SetTag("Enemy");
  * @endcode
+ *
+ * Names and tags are interned through NameRegistry and indexed by the
+ * owning Scene, see Scene::FindByTag() and Scene::FindByName().
+ *
+ * Updateable components are driven by the Scene's per-type update lists
+ * (see UpdateBuckets), not by the GameObject itself.
  */
 class GameObject
 {
@@ -35,16 +49,15 @@ public:
     GameObject(Scene& parentScene);
     ~GameObject() = default;
 
-    /** @brief Updates all updateable components. */
-    void Tick();
-    
-    /** @brief Runs fixed-timestep physics updates on components. */
-    void FixedUpdate();
-
     /** @brief Called when the object is added to the scene. */
     void Mounted();
     
-    /** @brief Requests destruction of this GameObject. */
+    /**
+     * @brief Requests destruction of this GameObject.
+     *
+     * Pooled objects (see ObjectPool) are disabled and returned to their
+     * pool at frame end instead of being freed.
+     */
     void Destroy();
     
     /** @brief Called by Scene when actually destroying the object. */
@@ -95,7 +108,7 @@ public:
     std::vector<T*> GetComponents() const;
 
     /** @brief Returns all components attached to this GameObject. */
-    const std::vector<std::unique_ptr<Component>>& GetAllComponents() const { return components_; }
+    const std::vector<ComponentPtr>& GetAllComponents() const { return components_; }
     
     /** @brief Marks this object for destruction. */
     void MarkAsDestroyed() { isDestroyed_ = true; }
@@ -109,6 +122,58 @@ public:
     /** @brief Returns the unique ID of this GameObject. */
     size_t GetId() const { return id_; }
 
+    /**
+     * @brief Sets the name of this GameObject.
+     * @param name Name to assign (interned, empty clears it)
+     */
+    void SetName(std::string_view name);
+
+    /** @brief Returns the name of this GameObject. */
+    const std::string& GetName() const { return NameRegistry::GetString(nameId_); }
+
+    /** @brief Returns the interned name id. */
+    NameId GetNameId() const { return nameId_; }
+
+    /**
+     * @brief Sets the tag of this GameObject.
+     * @param tag Tag to assign (interned, empty clears it)
+     */
+    void SetTag(std::string_view tag);
+
+    /** @brief Returns the tag of this GameObject. */
+    const std::string& GetTag() const { return NameRegistry::GetString(tagId_); }
+
+    /** @brief Returns the interned tag id. */
+    NameId GetTagId() const { return tagId_; }
+
+    /** @brief Returns true if this object has the given interned tag. */
+    bool CompareTag(NameId tag) const { return tagId_ == tag; }
+
+    /** @brief Returns true if this object has the given tag. */
+    bool CompareTag(std::string_view tag) const { return tagId_ == NameRegistry::Find(tag); }
+
+    /**
+     * @brief Attaches this object to a parent in the same scene.
+     *
+     * The local transform is kept and becomes relative to the parent.
+     * Destroying a parent also destroys its children.
+     *
+     * @param parent New parent, or nullptr to make this a root object
+     */
+    void SetParent(GameObject* parent);
+
+    /** @brief Returns the parent object, or nullptr for a root object. */
+    GameObject* GetParent() const { return parent_; }
+
+    /** @brief Returns the direct children of this object. */
+    const std::vector<GameObject*>& GetChildren() const { return children_; }
+
+    /** @brief Returns whether this object has been mounted into its scene. */
+    bool IsMounted() const { return isMounted_; }
+
+    /** @brief Returns whether this object belongs to an ObjectPool (Destroy() recycles it). */
+    bool IsPooled() const { return pool_ != nullptr; }
+
     /** @brief Returns whether this object has any collider components. */
     bool HasCollider() const;
 
@@ -120,20 +185,46 @@ public:
     }
 
 private:
+    friend class Scene;
+    friend class Prefab;
+    friend class SceneSerializer;
+    friend class SceneSnapshot;
+    friend class Component;
+    friend class ScriptableComponent;
+
+    // Used by Prefab instantiation and scene loading: no TransformComponent
+    // is created, the first adopted component must be one.
+    struct NoTransformTag {};
+    GameObject(Scene& parentScene, NoTransformTag);
+
+    void AdoptComponent(ComponentPtr component);
+
     Scene& parentScene_;
+    ObjectPool* pool_ = nullptr;
     GameObject* parent_ = nullptr;
+    std::vector<GameObject*> children_;
     TransformComponent* transform_;
     
     size_t id_;
-    static size_t nextId_;
+    static std::atomic<size_t> nextId_;
+
+    NameId nameId_ = InvalidNameId;
+    NameId tagId_ = InvalidNameId;
+    uint32_t spatialHandle_ = InvalidQuadtreeHandle; // Entry in the scene's spatial index
 
     EngineContext& ctx_();
 
+    void DetachFromHierarchy();
+    void RegisterComponent(Component& component);
+    void OnComponentToggled(Component& component);
+    void OnUpdateFrequencyChanged(ScriptableComponent& script);
+    void OnRenderableChanged(Component& component);
+
     bool isEnabled_ = true;
     bool isDestroyed_ = false;
-    bool isFirstUpdate_ = true;
+    bool isMounted_ = false;
 
-    std::vector<std::unique_ptr<Component>> components_;
+    std::vector<ComponentPtr> components_;
 };
 
 template <typename T, typename... Args>
@@ -141,11 +232,16 @@ inline T* GameObject::AddComponent(Args&&... args)
 {
     static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
 
-    auto comp = std::make_unique<T>(std::forward<Args>(args)...);
+    ComponentPtr comp(new T(std::forward<Args>(args)...));
     comp->Bind(this);
+    comp->DetectEnableCallbacks<T>();
 
-    T* rawPtr = comp.get();
+    T* rawPtr = static_cast<T*>(comp.get());
     components_.emplace_back(std::move(comp));
+
+    // Components of mounted objects join the scene's update lists right away
+    if (isMounted_)
+        RegisterComponent(*rawPtr);
     return rawPtr;
 }
 
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace Axion
+{
+
+/** @brief Interned string identifier. Zero is reserved for "no name". */
+using NameId = uint32_t;
+
+/** @brief Identifier returned for empty or unknown names. */
+inline constexpr NameId InvalidNameId = 0;
+
+/**
+ * @brief Global intern table for GameObject names and tags.
+ *
+ * Each distinct string is stored once and mapped to a small integer id,
+ * so tag comparisons and scene index lookups hash an integer instead of
+ * a string.
+ *
+ * @par Usage:
+ * @code
+ * static const NameId playerTag = NameRegistry::Intern("Player");
+ * if (go->GetTagId() == playerTag) { ... }
+ * @endcode
+ *
+ * @note Thread safety: all methods lock an internal mutex.
+ */
+class NameRegistry
+{
+public:
+    /**
+     * @brief Returns the id of a string, interning it if needed.
+     * @param name String to intern
+     * @return Interned id, or InvalidNameId for an empty string
+     */
+    static NameId Intern(std::string_view name)
+    {
+        if (name.empty())
+            return InvalidNameId;
+
+        Table& table = GetTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto it = table.ids.find(name);
+        if (it != table.ids.end())
+            return it->second;
+
+        const NameId id = static_cast<NameId>(table.strings.size());
+        const std::string& stored = table.strings.emplace_back(name);
+        table.ids.emplace(std::string_view(stored), id);
+        return id;
+    }
+
+    /**
+     * @brief Returns the id of an already interned string.
+     * @param name String to look up
+     * @return Interned id, or InvalidNameId if the string was never interned
+     */
+    static NameId Find(std::string_view name)
+    {
+        if (name.empty())
+            return InvalidNameId;
+
+        Table& table = GetTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto it = table.ids.find(name);
+        return it != table.ids.end() ? it->second : InvalidNameId;
+    }
+
+    /**
+     * @brief Returns the string for an interned id.
+     * @param id Interned id
+     * @return The interned string, or an empty string for unknown ids
+     */
+    static const std::string& GetString(NameId id)
+    {
+        Table& table = GetTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        if (id >= table.strings.size())
+            return table.strings[InvalidNameId];
+        return table.strings[id];
+    }
+
+private:
+    struct Table
+    {
+        std::mutex mutex;
+        std::deque<std::string> strings{std::string()}; // Deque keeps string_view keys stable
+        std::unordered_map<std::string_view, NameId> ids;
+    };
+
+    static Table& GetTable()
+    {
+        static Table table;
+        return table;
+    }
+};
+
+} // namespace Axion
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+
+namespace Axion
+{
+
+class GameObject;
+class Prefab;
+
+/**
+ * @brief Recycles GameObjects built from a Prefab.
+ *
+ * Pools are created and owned by a Scene (see Scene::CreatePool()). A pooled
+ * object is never freed while its scene is alive: GameObject::Destroy()
+ * disables it and returns it to the pool's free list at frame end, and
+ * Scene::Acquire() hands it back out after resetting its components
+ * (Component::OnReset()). Once the pool has grown to the peak number of
+ * live objects, spawning and destroying no longer allocate.
+ *
+ * @par Usage:
+ * @code
+ * ObjectPool* bullets = CreatePool(bulletPrefab, 64);
+ *
+ * GameObject* bullet = Acquire(*bullets, muzzlePosition);
+ * // ...
+ * bullet->Destroy(); // back to the free list
+ * @endcode
+ */
+class ObjectPool
+{
+public:
+    /** @param prefab Template of the pooled objects; must outlive the pool */
+    explicit ObjectPool(const Prefab& prefab) : prefab_(prefab) {}
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    /** @brief Returns the template of the pooled objects. */
+    const Prefab& GetPrefab() const { return prefab_; }
+
+    /** @brief Returns the number of objects created by this pool. */
+    size_t GetSize() const { return size_; }
+
+    /** @brief Returns the number of objects waiting to be reused. */
+    size_t GetFreeCount() const { return free_.size(); }
+
+    /** @brief Returns the number of objects currently in use. */
+    size_t GetActiveCount() const { return size_ - free_.size(); }
+
+private:
+    friend class Scene;
+
+    const Prefab& prefab_;
+    std::vector<GameObject*> free_;
+    size_t size_ = 0;
+};
+
+} // namespace Axion
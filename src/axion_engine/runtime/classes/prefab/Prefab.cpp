@@ -0,0 +1,40 @@
+#include "Prefab.hpp"
+
+#include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
+
+namespace Axion
+{
+
+Prefab::Prefab()
+{
+    AddEntry(new TransformComponent());
+}
+
+ComponentBlock* Prefab::AllocateBlock(size_t count) const
+{
+    auto* block = new ComponentBlock();
+    block->alignment = std::align_val_t(alignment_);
+    block->memory = ::operator new(GetInstanceStride() * count, block->alignment);
+    return block;
+}
+
+std::unique_ptr<GameObject> Prefab::CreateInstance(Scene& scene, ComponentBlock& block, size_t index) const
+{
+    auto* base = static_cast<std::byte*>(block.memory) + GetInstanceStride() * index;
+
+    std::unique_ptr<GameObject> object(new GameObject(scene, GameObject::NoTransformTag{}));
+    object->components_.reserve(entries_.size());
+    object->nameId_ = nameId_;
+    object->tagId_ = tagId_;
+
+    // Entry 0 is the transform, so the object's transform_ is set first
+    for (const Entry& entry : entries_)
+    {
+        Component* component = entry.clone(*entry.prototype, base + entry.offset);
+        ++block.liveCount;
+        object->AdoptComponent(ComponentPtr(component, ComponentDeleter{&block}));
+    }
+    return object;
+}
+
+} // namespace Axion
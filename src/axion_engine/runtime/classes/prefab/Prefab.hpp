@@ -0,0 +1,162 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "axion_engine/runtime/components/Component.hpp"
+#include "axion_engine/runtime/components/transform/TransformComponent.hpp"
+#include "axion_engine/runtime/classes/gameObject/NameRegistry.hpp"
+
+namespace Axion
+{
+
+class GameObject;
+class Scene;
+
+/**
+ * @brief Template for spawning many GameObjects with the same components.
+ *
+ * A Prefab holds one configured prototype of each component. Scene::Instantiate()
+ * copy-constructs the prototypes into fresh GameObjects; all components of a
+ * batch are cloned into a single allocation sized from the prefab's layout,
+ * instead of one heap allocation per component.
+ *
+ * Components must be copy-constructible. The copy constructor is expected to
+ * copy settings only (see Component's copy constructor).
+ *
+ * @par Usage:
+ * @code
+ * Prefab bullet;
+ * bullet.GetTransform()->SetScale({12.0f, 12.0f, 1.0f});
+ * bullet.AddComponent<CircleRenderComponent>()->SetRadius(1.0f);
+ * bullet.AddComponent<BulletScript>();
+ *
+ * auto spawned = scene->Instantiate(bullet, 32, positions);
+ * @endcode
+ */
+class Prefab
+{
+public:
+    Prefab();
+
+    Prefab(Prefab&&) noexcept = default;
+    Prefab& operator=(Prefab&&) noexcept = default;
+
+    Prefab(const Prefab&) = delete;
+    Prefab& operator=(const Prefab&) = delete;
+
+    /**
+     * @brief Adds a prototype component.
+     * @tparam T Component type (must derive from Component and be copy-constructible)
+     * @param args Arguments forwarded to the prototype's constructor
+     * @return Pointer to the prototype, to configure it
+     */
+    template <typename T, typename... Args>
+    T* AddComponent(Args&&... args);
+
+    /**
+     * @brief Finds the first prototype of the specified type.
+     * @return Pointer to the prototype, or nullptr if not found
+     */
+    template <typename T>
+    T* GetComponent() const;
+
+    /** @brief Returns the prototype transform; instances start from its values. */
+    TransformComponent* GetTransform() const { return static_cast<TransformComponent*>(entries_.front().prototype.get()); }
+
+    /** @brief Sets the name given to every instance. */
+    void SetName(std::string_view name) { nameId_ = NameRegistry::Intern(name); }
+
+    /** @brief Sets the tag given to every instance. */
+    void SetTag(std::string_view tag) { tagId_ = NameRegistry::Intern(tag); }
+
+    /** @brief Returns the number of components per instance, transform included. */
+    size_t GetComponentCount() const { return entries_.size(); }
+
+private:
+    friend class Scene;
+
+    using CloneFn = Component* (*)(const Component& prototype, void* memory);
+
+    struct Entry
+    {
+        std::unique_ptr<Component> prototype;
+        size_t offset = 0; ///< Byte offset inside one instance's slice of the block
+        CloneFn clone = nullptr;
+    };
+
+    template <typename T>
+    static Component* Clone(const Component& prototype, void* memory)
+    {
+        return new (memory) T(static_cast<const T&>(prototype));
+    }
+
+    template <typename T>
+    void AddEntry(T* prototype);
+
+    /** @brief Bytes per instance in a block, padded to the largest alignment. */
+    size_t GetInstanceStride() const { return (stride_ + alignment_ - 1) / alignment_ * alignment_; }
+
+    /** @brief Allocates component storage for count instances. */
+    ComponentBlock* AllocateBlock(size_t count) const;
+
+    /**
+     * @brief Builds one unmounted instance.
+     * @param scene Scene that will own the instance
+     * @param block Storage from AllocateBlock()
+     * @param index Slot of the instance in the block
+     */
+    std::unique_ptr<GameObject> CreateInstance(Scene& scene, ComponentBlock& block, size_t index) const;
+
+    std::vector<Entry> entries_;
+    size_t stride_ = 0;
+    size_t alignment_ = alignof(std::max_align_t);
+
+    NameId nameId_ = InvalidNameId;
+    NameId tagId_ = InvalidNameId;
+};
+
+template <typename T, typename... Args>
+inline T* Prefab::AddComponent(Args&&... args)
+{
+    static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
+    static_assert(!std::is_same_v<T, TransformComponent>, "Every prefab already has a transform, use GetTransform()");
+
+    T* prototype = new T(std::forward<Args>(args)...);
+    AddEntry(prototype);
+    return prototype;
+}
+
+template <typename T>
+inline T* Prefab::GetComponent() const
+{
+    for (const auto& entry : entries_)
+    {
+        if (auto casted = dynamic_cast<T*>(entry.prototype.get()))
+            return casted;
+    }
+    return nullptr;
+}
+
+template <typename T>
+inline void Prefab::AddEntry(T* prototype)
+{
+    static_assert(std::is_copy_constructible_v<T>, "Prefab components must be copy-constructible");
+
+    // Instances copy the flag from their prototype
+    static_cast<Component*>(prototype)->DetectEnableCallbacks<T>();
+
+    Entry entry;
+    entry.prototype.reset(prototype);
+    entry.offset = (stride_ + alignof(T) - 1) / alignof(T) * alignof(T);
+    entry.clone = &Clone<T>;
+
+    stride_ = entry.offset + sizeof(T);
+    if (alignof(T) > alignment_)
+        alignment_ = alignof(T);
+    entries_.push_back(std::move(entry));
+}
+
+} // namespace Axion
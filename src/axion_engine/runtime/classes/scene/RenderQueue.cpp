@@ -0,0 +1,472 @@
+#include "RenderQueue.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
+
+namespace Axion
+{
+
+namespace
+{
+
+constexpr size_t kInsertionSortLimit = 32; // Changed keys up to which the sorted order is patched in place
+constexpr size_t kCandidateSortRatio = 8;  // Sort the candidates alone when they are this much fewer than all items
+
+} // namespace
+
+void RenderQueue::Register(Component& component)
+{
+    if (component.renderSlot_ != UINT32_MAX)
+        return;
+
+    auto* renderable = dynamic_cast<IRenderable*>(&component);
+    if (!renderable)
+        return;
+
+    uint32_t slot;
+    if (!freeSlots_.empty())
+    {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(items_.size());
+        items_.emplace_back();
+    }
+
+    if (nextSequence_ == UINT16_MAX)
+        RenumberSequences();
+
+    Item& item = items_[slot];
+    item = Item{};
+    item.component = &component;
+    item.renderable = renderable;
+    item.sequence = nextSequence_;
+    if (nextSequence_ < UINT16_MAX)
+        ++nextSequence_; // Saturates only with 65535 live renderables
+    component.renderSlot_ = slot;
+
+    order_.push_back(slot);
+    ++changedKeys_;
+    Update(slot);
+}
+
+void RenderQueue::Unregister(Component& component)
+{
+    const uint32_t slot = component.renderSlot_;
+    if (slot == UINT32_MAX)
+        return;
+
+    Item& item = items_[slot];
+    if (item.treeHandle != InvalidQuadtreeHandle)
+        (item.isStatic ? staticTree_ : tree_).Remove(item.treeHandle);
+    if (item.isStatic)
+        staticChanges_.push_back(item.staticArea);
+    RemoveUnbounded(slot);
+    ReleaseTextureId(item.texture);
+
+    {
+        std::lock_guard<std::mutex> lock(dirtyMutex_);
+        item = Item{};
+    }
+    component.renderSlot_ = UINT32_MAX;
+    releasedSlots_.push_back(slot);
+    compactNeeded_ = true;
+}
+
+void RenderQueue::MarkDirty(Component& component)
+{
+    const uint32_t slot = component.renderSlot_;
+    if (slot == UINT32_MAX)
+        return;
+
+    std::lock_guard<std::mutex> lock(dirtyMutex_);
+    Item& item = items_[slot];
+    if (!item.dirty)
+    {
+        item.dirty = true;
+        dirty_.push_back(slot);
+    }
+}
+
+void RenderQueue::MarkMoved(const GameObject& object)
+{
+    for (const auto& component : object.GetAllComponents())
+    {
+        if (component->renderSlot_ != UINT32_MAX)
+            MarkDirty(*component);
+    }
+}
+
+void RenderQueue::Clear()
+{
+    for (Item& item : items_)
+    {
+        if (item.component)
+            item.component->renderSlot_ = UINT32_MAX;
+    }
+
+    items_.clear();
+    freeSlots_.clear();
+    releasedSlots_.clear();
+    order_.clear();
+    unbounded_.clear();
+    tree_.Clear();
+    staticTree_.Clear();
+    staticChanges_.clear();
+    staticReset_ = true;
+    {
+        std::lock_guard<std::mutex> lock(dirtyMutex_);
+        dirty_.clear();
+    }
+    textureIds_.clear();
+    freeTextureIds_.clear();
+    nextTextureId_ = 1;
+    nextSequence_ = 0;
+    changedKeys_ = 0;
+    compactNeeded_ = false;
+}
+
+void RenderQueue::SetBounds(const glm::vec2& center, float halfSize, uint32_t maxDepth)
+{
+    tree_.Reset(center, halfSize, maxDepth);
+    staticTree_.Reset(center, halfSize, maxDepth);
+
+    // Handles died with the old tree; the next Refresh() inserts the items again
+    std::lock_guard<std::mutex> lock(dirtyMutex_);
+    for (uint32_t slot = 0; slot < items_.size(); ++slot)
+    {
+        Item& item = items_[slot];
+        if (!item.component || item.treeHandle == InvalidQuadtreeHandle)
+            continue;
+
+        item.treeHandle = InvalidQuadtreeHandle;
+        if (!item.dirty)
+        {
+            item.dirty = true;
+            dirty_.push_back(slot);
+        }
+    }
+}
+
+void RenderQueue::GetBounds(glm::vec2& min, glm::vec2& max) const
+{
+    const glm::vec2 half(staticTree_.GetHalfSize());
+    min = staticTree_.GetCenter() - half;
+    max = staticTree_.GetCenter() + half;
+}
+
+void RenderQueue::Refresh()
+{
+    {
+        std::lock_guard<std::mutex> lock(dirtyMutex_);
+        refreshing_.swap(dirty_);
+        for (uint32_t slot : refreshing_)
+            items_[slot].dirty = false;
+    }
+    for (uint32_t slot : refreshing_)
+    {
+        if (items_[slot].component)
+            Update(slot);
+    }
+    refreshing_.clear();
+
+    if (compactNeeded_)
+    {
+        order_.erase(std::remove_if(order_.begin(), order_.end(),
+                                    [this](uint32_t slot) { return items_[slot].component == nullptr; }),
+                     order_.end());
+        freeSlots_.insert(freeSlots_.end(), releasedSlots_.begin(), releasedSlots_.end());
+        releasedSlots_.clear();
+        compactNeeded_ = false;
+    }
+
+    if (changedKeys_ == 0)
+        return;
+    if (changedKeys_ <= kInsertionSortLimit)
+        InsertionSort();
+    else
+        RadixSort();
+    changedKeys_ = 0;
+}
+
+size_t RenderQueue::Collect(const glm::vec2& viewMin, const glm::vec2& viewMax, std::vector<IRenderable*>& out)
+{
+    out.clear();
+    if (++frame_ == 0)
+        ++frame_;
+
+    candidates_.clear();
+    tree_.Query(viewMin, viewMax,
+                [this](uint32_t slot, const glm::vec2&, const glm::vec2&) { candidates_.push_back(slot); });
+    const size_t culled = tree_.GetCount() - candidates_.size();
+    candidates_.insert(candidates_.end(), unbounded_.begin(), unbounded_.end());
+
+    if (candidates_.size() * kCandidateSortRatio < order_.size())
+    {
+        // Few visible: sorting them beats walking the whole order
+        std::sort(candidates_.begin(), candidates_.end(),
+                  [this](uint32_t a, uint32_t b) { return items_[a].key < items_[b].key; });
+        for (uint32_t slot : candidates_)
+        {
+            if (items_[slot].component->IsActive())
+                out.push_back(items_[slot].renderable);
+        }
+        return culled;
+    }
+
+    for (uint32_t slot : candidates_)
+        items_[slot].visibleFrame = frame_;
+    for (uint32_t slot : order_)
+    {
+        const Item& item = items_[slot];
+        if (item.visibleFrame == frame_ && item.component->IsActive())
+            out.push_back(item.renderable);
+    }
+    return culled;
+}
+
+void RenderQueue::CollectStatic(RenderLayer layer, const glm::vec2& min, const glm::vec2& max,
+                                std::vector<IRenderable*>& out)
+{
+    out.clear();
+
+    candidates_.clear();
+    staticTree_.Query(min, max, [this, layer](uint32_t slot, const glm::vec2&, const glm::vec2&) {
+        const Item& item = items_[slot];
+        if (item.staticArea.layer == layer && item.component->IsActive())
+            candidates_.push_back(slot);
+    });
+
+    std::sort(candidates_.begin(), candidates_.end(),
+              [this](uint32_t a, uint32_t b) { return items_[a].key < items_[b].key; });
+    for (uint32_t slot : candidates_)
+        out.push_back(items_[slot].renderable);
+}
+
+bool RenderQueue::TakeStaticChanges(std::vector<StaticArea>& out)
+{
+    out.clear();
+    out.swap(staticChanges_);
+
+    const bool reset = staticReset_;
+    staticReset_ = false;
+    return reset;
+}
+
+uint64_t RenderQueue::MakeSortKey(RenderLayer layer, int order, uint16_t texture, uint16_t sequence)
+{
+    constexpr int kOrderBias = 1 << 19;
+    const auto layerBits = static_cast<uint64_t>(std::clamp(static_cast<int>(layer), 0, 4095));
+    const auto orderBits = static_cast<uint64_t>(std::clamp(order, -kOrderBias, kOrderBias - 1) + kOrderBias);
+    return layerBits << 52 | orderBits << 32 | static_cast<uint64_t>(texture) << 16 | sequence;
+}
+
+void RenderQueue::Update(uint32_t slot)
+{
+    Item& item = items_[slot];
+    IRenderable* renderable = item.renderable;
+
+    SDL_Texture* texture = renderable->GetBatchTexture();
+    if (texture != item.texture)
+    {
+        ReleaseTextureId(item.texture);
+        item.textureId = AcquireTextureId(texture);
+        item.texture = texture;
+    }
+
+    const uint64_t key =
+        MakeSortKey(renderable->GetLayer(), renderable->GetOrderInLayer(), item.textureId, item.sequence);
+    if (key != item.key)
+    {
+        item.key = key;
+        ++changedKeys_;
+    }
+
+    glm::vec2 min(0.0f), max(0.0f);
+    const bool bounded = renderable->GetWorldBounds(min, max);
+    bool isStatic = bounded && renderable->IsStatic();
+    if (isStatic)
+    {
+        // Chunks are only kept inside the world bounds
+        glm::vec2 worldMin, worldMax;
+        GetBounds(worldMin, worldMax);
+        isStatic = min.x >= worldMin.x && min.y >= worldMin.y && max.x <= worldMax.x && max.y <= worldMax.y;
+    }
+
+    // The old baked area needs a redraw whatever changed
+    if (item.isStatic)
+        staticChanges_.push_back(item.staticArea);
+
+    if (item.isStatic != isStatic && item.treeHandle != InvalidQuadtreeHandle)
+    {
+        (item.isStatic ? staticTree_ : tree_).Remove(item.treeHandle);
+        item.treeHandle = InvalidQuadtreeHandle;
+    }
+    item.isStatic = isStatic;
+
+    if (!isStatic)
+    {
+        SetBounded(slot, bounded, min, max);
+        return;
+    }
+
+    RemoveUnbounded(slot);
+    if (item.treeHandle == InvalidQuadtreeHandle)
+        item.treeHandle = staticTree_.Insert(slot, min, max);
+    else
+        staticTree_.Update(item.treeHandle, min, max);
+
+    item.staticArea = {renderable->GetLayer(), min, max};
+    staticChanges_.push_back(item.staticArea);
+}
+
+void RenderQueue::SetBounded(uint32_t slot, bool bounded, const glm::vec2& min, const glm::vec2& max)
+{
+    Item& item = items_[slot];
+    if (!bounded)
+    {
+        if (item.treeHandle != InvalidQuadtreeHandle)
+        {
+            tree_.Remove(item.treeHandle);
+            item.treeHandle = InvalidQuadtreeHandle;
+        }
+        if (item.unboundedIndex == UINT32_MAX)
+        {
+            item.unboundedIndex = static_cast<uint32_t>(unbounded_.size());
+            unbounded_.push_back(slot);
+        }
+        return;
+    }
+
+    RemoveUnbounded(slot);
+    if (item.treeHandle == InvalidQuadtreeHandle)
+        item.treeHandle = tree_.Insert(slot, min, max);
+    else
+        tree_.Update(item.treeHandle, min, max);
+}
+
+void RenderQueue::RemoveUnbounded(uint32_t slot)
+{
+    Item& item = items_[slot];
+    if (item.unboundedIndex == UINT32_MAX)
+        return;
+
+    const uint32_t moved = unbounded_.back();
+    unbounded_[item.unboundedIndex] = moved;
+    items_[moved].unboundedIndex = item.unboundedIndex;
+    unbounded_.pop_back();
+    item.unboundedIndex = UINT32_MAX;
+}
+
+uint16_t RenderQueue::AcquireTextureId(SDL_Texture* texture)
+{
+    if (!texture)
+        return 0;
+
+    auto [it, inserted] = textureIds_.try_emplace(texture);
+    TextureId& entry = it->second;
+    if (inserted)
+    {
+        if (!freeTextureIds_.empty())
+        {
+            entry.id = freeTextureIds_.back();
+            freeTextureIds_.pop_back();
+        }
+        else if (nextTextureId_ != 0)
+        {
+            entry.id = nextTextureId_++; // Wraps to 0 once 65535 ids are live
+        }
+        // Beyond 65535 live textures the rest share id 0; only batching suffers
+    }
+    ++entry.users;
+    return entry.id;
+}
+
+void RenderQueue::ReleaseTextureId(SDL_Texture* texture)
+{
+    if (!texture)
+        return;
+
+    auto it = textureIds_.find(texture);
+    if (it == textureIds_.end() || --it->second.users > 0)
+        return;
+
+    if (it->second.id != 0)
+        freeTextureIds_.push_back(it->second.id);
+    textureIds_.erase(it);
+}
+
+void RenderQueue::RenumberSequences()
+{
+    // In draw order, so renderables with equal layer, order and texture keep their relative order
+    std::sort(order_.begin(), order_.end(), [this](uint32_t a, uint32_t b) { return items_[a].key < items_[b].key; });
+
+    uint16_t sequence = 0;
+    for (uint32_t slot : order_)
+    {
+        Item& item = items_[slot];
+        if (!item.component)
+            continue;
+
+        item.sequence = sequence;
+        item.key = (item.key & ~uint64_t{0xFFFF}) | sequence;
+        if (sequence < UINT16_MAX)
+            ++sequence;
+    }
+    nextSequence_ = sequence;
+}
+
+void RenderQueue::InsertionSort()
+{
+    // The order is sorted except for the few changed or appended items
+    for (size_t i = 1; i < order_.size(); ++i)
+    {
+        const uint32_t slot = order_[i];
+        const uint64_t key = items_[slot].key;
+        size_t j = i;
+        while (j > 0 && items_[order_[j - 1]].key > key)
+        {
+            order_[j] = order_[j - 1];
+            --j;
+        }
+        order_[j] = slot;
+    }
+}
+
+void RenderQueue::RadixSort()
+{
+    // LSD radix sort on the key bytes; bytes equal for every item are skipped
+    const size_t count = order_.size();
+    sortScratch_.resize(count);
+    uint32_t* source = order_.data();
+    uint32_t* target = sortScratch_.data();
+
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        std::array<size_t, 256> offsets{};
+        for (size_t i = 0; i < count; ++i)
+            ++offsets[(items_[source[i]].key >> shift) & 0xFF];
+        if (std::find(offsets.begin(), offsets.end(), count) != offsets.end())
+            continue;
+
+        size_t total = 0;
+        for (size_t& offset : offsets)
+        {
+            const size_t n = offset;
+            offset = total;
+            total += n;
+        }
+        for (size_t i = 0; i < count; ++i)
+            target[offsets[(items_[source[i]].key >> shift) & 0xFF]++] = source[i];
+        std::swap(source, target);
+    }
+
+    if (source != order_.data())
+        std::copy(source, source + count, order_.data());
+}
+
+} // namespace Axion
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include "axion_engine/runtime/interfaces/IRenderable.hpp"
+#include "axion_utilities/spatial/LooseQuadtree.hpp"
+
+namespace Axion
+{
+
+class Component;
+class GameObject;
+
+/** @brief World area of one layer whose static renderables changed. */
+struct StaticArea
+{
+    RenderLayer layer = RenderLayer::Default;
+    glm::vec2 min{0.0f};
+    glm::vec2 max{0.0f};
+};
+
+/**
+ * @brief Persistent, sorted list of the renderables of a scene.
+ *
+ * Renderables are registered when their GameObject is mounted (like
+ * UpdateBuckets) instead of being collected every frame. Each one gets a
+ * packed 64-bit sort key, from the most to the least significant bits:
+ *
+ * | Bits | Field |
+ * |------|-------|
+ * | 12 | Render layer |
+ * | 20 | Order in layer (signed, clamped) |
+ * | 16 | Texture (IRenderable::GetBatchTexture()), so equal-order sprites share batches |
+ * | 16 | Registration sequence, keeping the order of equal keys stable |
+ *
+ * Texture ids are reference counted and reused once no renderable uses the
+ * texture. When the sequence counter runs out, live renderables are
+ * renumbered in draw order, so equal keys keep their relative order.
+ *
+ * Keys and world bounds are recomputed only for renderables marked dirty:
+ * those whose object moved (Scene::UpdateTransforms()) and those whose
+ * render settings changed (Component::MarkRenderDirty()). The draw order is
+ * re-sorted only when a key changed: by insertion into the already sorted
+ * order when few did, by radix sort otherwise.
+ *
+ * Bounded renderables live in a loose quadtree, so culling against the view
+ * only visits what is near it. Renderables without bounds are always drawn.
+ *
+ * Static renderables (IRenderable::IsStatic()) with bounds inside the area
+ * set by SetBounds() are kept apart (those reaching outside it are treated
+ * as dynamic):
+ * Collect() skips them, CollectStatic() returns them by area, and every
+ * registration, refresh or removal of one records the areas it covered so
+ * the RenderManager can re-bake them (TakeStaticChanges()).
+ */
+class RenderQueue
+{
+public:
+    /** @brief Registers a component if it is IRenderable. */
+    void Register(Component& component);
+
+    /** @brief Removes a registered component. */
+    void Unregister(Component& component);
+
+    /**
+     * @brief Schedules a registered component's key and bounds for recomputation.
+     * @note Thread-safe.
+     */
+    void MarkDirty(Component& component);
+
+    /** @brief Marks every registered renderable of an object dirty (it moved). */
+    void MarkMoved(const GameObject& object);
+
+    /** @brief Drops every renderable. */
+    void Clear();
+
+    /** @brief Sets the area covered by the culling tree (see Scene::SetSpatialBounds()). */
+    void SetBounds(const glm::vec2& center, float halfSize, uint32_t maxDepth);
+
+    /** @brief Returns the corners of the area set by SetBounds(); static areas never leave it. */
+    void GetBounds(glm::vec2& min, glm::vec2& max) const;
+
+    /**
+     * @brief Recomputes dirty keys and bounds, and restores the draw order.
+     * @note Main thread, once per frame before Collect().
+     */
+    void Refresh();
+
+    /**
+     * @brief Collects the active renderables that may overlap a rectangle, in draw order.
+     * @param viewMin Lower corner of the view (world X/Y)
+     * @param viewMax Upper corner of the view (world X/Y)
+     * @param out Cleared, then receives the renderables
+     * @return Number of bounded renderables outside the view
+     */
+    size_t Collect(const glm::vec2& viewMin, const glm::vec2& viewMax, std::vector<IRenderable*>& out);
+
+    /**
+     * @brief Collects the active static renderables of a layer overlapping a rectangle, in draw order.
+     * @param out Cleared, then receives the renderables
+     */
+    void CollectStatic(RenderLayer layer, const glm::vec2& min, const glm::vec2& max, std::vector<IRenderable*>& out);
+
+    /**
+     * @brief Hands over the static areas changed since the last call.
+     * @param out Cleared, then receives the areas
+     * @return True if the queue was cleared since the last call (every static area changed)
+     */
+    bool TakeStaticChanges(std::vector<StaticArea>& out);
+
+    /** @brief Returns the number of registered renderables. */
+    size_t GetCount() const { return items_.size() - freeSlots_.size(); }
+
+    /** @brief Packs a sort key (see the class description). */
+    static uint64_t MakeSortKey(RenderLayer layer, int order, uint16_t texture, uint16_t sequence);
+
+private:
+    struct Item
+    {
+        Component* component = nullptr; // Null for free slots
+        IRenderable* renderable = nullptr;
+        uint64_t key = 0;
+        uint32_t treeHandle = InvalidQuadtreeHandle; // In staticTree_ if isStatic; invalid while unbounded
+        uint32_t unboundedIndex = UINT32_MAX;
+        uint32_t visibleFrame = 0;
+        SDL_Texture* texture = nullptr; // Holds a reference on its texture id
+        uint16_t textureId = 0;
+        uint16_t sequence = 0;
+        bool dirty = false;
+        bool isStatic = false;
+        StaticArea staticArea; // Where a static item was last baked
+    };
+
+    void Update(uint32_t slot);
+    void SetBounded(uint32_t slot, bool bounded, const glm::vec2& min, const glm::vec2& max);
+    void RemoveUnbounded(uint32_t slot);
+    uint16_t AcquireTextureId(SDL_Texture* texture);
+    void ReleaseTextureId(SDL_Texture* texture);
+    void RenumberSequences();
+    void RadixSort();
+    void InsertionSort();
+
+    std::vector<Item> items_;
+    std::vector<uint32_t> freeSlots_;
+    std::vector<uint32_t> releasedSlots_; // Free once order_ no longer lists them
+    std::vector<uint32_t> order_;     // Live slots sorted by key (stale while sortNeeded_)
+    std::vector<uint32_t> unbounded_; // Slots drawn without culling
+    LooseQuadtree<uint32_t> tree_;    // Slots of bounded items
+    LooseQuadtree<uint32_t> staticTree_; // Slots of static items
+    std::vector<StaticArea> staticChanges_;
+    bool staticReset_ = false;
+
+    std::mutex dirtyMutex_; // Guards dirty_ and Item::dirty; settings may change on workers
+    std::vector<uint32_t> dirty_;
+    std::vector<uint32_t> refreshing_;
+
+    struct TextureId
+    {
+        uint16_t id = 0;
+        uint32_t users = 0;
+    };
+
+    std::unordered_map<SDL_Texture*, TextureId> textureIds_;
+    std::vector<uint16_t> freeTextureIds_;
+    uint16_t nextTextureId_ = 1; // 0 is "no texture"
+    uint16_t nextSequence_ = 0;
+    uint32_t frame_ = 0;
+    size_t changedKeys_ = 0; // Keys changed or added since the last sort
+    bool compactNeeded_ = false;
+
+    std::vector<uint32_t> candidates_;
+    std::vector<uint32_t> sortScratch_;
+};
+
+} // namespace Axion
@@ -1,21 +1,279 @@
 #include "Scene.hpp"
 
+#include <iterator>
+
+#include "axion_engine/managers/assets/AssetsManager.hpp"
+#include "axion_engine/runtime/classes/prefab/Prefab.hpp"
+#include "axion_engine/runtime/classes/serialization/SceneSerializer.hpp"
+
 namespace Axion
 {
 
+Scene::~Scene()
+{
+    // Preload jobs write into pendingTextures_
+    if (ctx_.jobs)
+        jobs().Wait(preloadJobs_);
+
+    for (auto &texture : pendingTextures_)
+    {
+        if (texture->surface)
+            SDL_FreeSurface(texture->surface);
+    }
+}
+
 void Scene::Tick()
 {
     OnSceneUpdate();
-    
-    // Update all game objects
-    for (auto &object : objects_)
+
+    if (streamer_)
+        streamer_->Update();
+
+    updateBuckets_.Update(ctx_, scheduler_);
+    scheduler_.Execute(ctx_, updateBuckets_.GetClock());
+    updateBuckets_.RunBudgeted(ctx_, scriptBudgetMs_);
+
+    // Starting may add buckets, which must wait until the scheduler is done with their lists
+    updateBuckets_.RunPendingStarts(ctx_);
+    FlushDeferredDestroys();
+}
+
+SceneStreamer *Scene::EnableStreaming(const StreamingConfig &config, SceneStreamer::ChunkGenerator generator)
+{
+    streamer_.reset();
+    streamer_ = std::make_unique<SceneStreamer>(ctx_, *this, config, std::move(generator));
+    return streamer_.get();
+}
+
+void Scene::Enter()
+{
+    if (loadState_ == LoadState::Preloading)
+        UpdatePreload(true);
+
+    if (loadState_ == LoadState::Preloaded)
     {
-        // Skip destroyed objects
-        if (object && !object->IsDestroyed())
+        // Objects were built and mounted ahead of time
+        loadState_ = LoadState::Active;
+        return;
+    }
+
+    if (loadState_ == LoadState::TearingDown)
+        FinishTeardown();
+
+    loadState_ = LoadState::Active;
+    OnScenePreload();
+    BuildPreloadedAtlases();
+    pendingTextures_.clear();
+    OnSceneEnter();
+    EmitMountedEvent();
+    EmitEnabledEvent();
+}
+
+void Scene::Exit()
+{
+    OnSceneExit();
+    streamer_.reset();
+    BeginTeardown();
+}
+
+void Scene::PreloadTexture(const std::string &id, const std::string &relativePath)
+{
+    if (!ctx_.assets || assets().GetTexture(id))
+        return;
+
+    if (loadState_ != LoadState::Preloading || !ctx_.jobs)
+    {
+        assets().LoadTexture(id, relativePath);
+        return;
+    }
+
+    auto texture = std::make_unique<PendingTexture>();
+    texture->id = id;
+    texture->path = relativePath;
+    PendingTexture *raw = texture.get();
+    pendingTextures_.emplace_back(std::move(texture));
+
+    AssetsManager *assetsManager = ctx_.assets;
+    jobs().Submit([assetsManager, raw]
+    {
+        raw->surface = assetsManager->DecodeSurface(raw->path);
+    }, &preloadJobs_);
+}
+
+void Scene::PreloadAtlasImage(const std::string &atlasId, const std::string &id, const std::string &relativePath)
+{
+    if (!ctx_.assets || assets().GetSprite(id).IsValid())
+        return;
+
+    if (std::find(preloadAtlases_.begin(), preloadAtlases_.end(), atlasId) == preloadAtlases_.end())
+        preloadAtlases_.push_back(atlasId);
+
+    auto texture = std::make_unique<PendingTexture>();
+    texture->id = id;
+    texture->path = relativePath;
+    texture->atlasId = atlasId;
+    PendingTexture *raw = texture.get();
+    pendingTextures_.emplace_back(std::move(texture));
+
+    // Outside preloading, BuildAtlas() decodes the image itself
+    if (loadState_ != LoadState::Preloading || !ctx_.jobs)
+        return;
+
+    AssetsManager *assetsManager = ctx_.assets;
+    jobs().Submit([assetsManager, raw]
+    {
+        raw->surface = assetsManager->DecodeSurface(raw->path);
+    }, &preloadJobs_);
+}
+
+void Scene::BuildPreloadedAtlases()
+{
+    for (const std::string &atlasId : preloadAtlases_)
+    {
+        for (auto &texture : pendingTextures_)
+        {
+            if (texture->atlasId != atlasId)
+                continue;
+
+            if (texture->surface)
+                assets().AddAtlasSurface(texture->id, texture->surface, texture->path);
+            else
+                assets().AddAtlasImage(texture->id, texture->path);
+            texture->surface = nullptr; // Owned by the AssetsManager now
+        }
+        assets().BuildAtlas(atlasId);
+    }
+    preloadAtlases_.clear();
+}
+
+void Scene::BeginPreload()
+{
+    if (loadState_ == LoadState::TearingDown)
+        FinishTeardown();
+    if (loadState_ != LoadState::Unloaded)
+        return;
+
+    loadState_ = LoadState::Preloading;
+    OnScenePreload();
+}
+
+bool Scene::UpdatePreload(bool block)
+{
+    if (loadState_ != LoadState::Preloading)
+        return loadState_ == LoadState::Preloaded;
+
+    if (ctx_.jobs)
+    {
+        if (block)
+            jobs().Wait(preloadJobs_);
+        else if (!preloadJobs_.IsDone())
+            return false;
+    }
+
+    // Textures must be created on the main thread
+    for (auto &texture : pendingTextures_)
+    {
+        if (texture->atlasId.empty() && texture->surface)
         {
-            object->Tick();
+            assets().CreateTexture(texture->id, texture->surface, texture->path);
+            texture->surface = nullptr;
         }
     }
+    BuildPreloadedAtlases();
+    pendingTextures_.clear();
+
+    OnSceneEnter();
+    ProcessSpawnQueue();
+    loadState_ = LoadState::Preloaded;
+    return true;
+}
+
+void Scene::BeginTeardown()
+{
+    if (loadState_ == LoadState::TearingDown)
+        return;
+
+    updateBuckets_.Clear();
+    renderQueue_.Clear();
+    destroyQueue_.clear();
+    {
+        std::lock_guard<std::mutex> lock(structureMutex_);
+        deferredDestroys_.clear();
+    }
+
+    // Objects that never made it to the scene are released with the rest
+    TakeSpawnQueue();
+
+    // Destroys from here on must not reach the pools
+    for (const auto &object : objects_)
+        object->pool_ = nullptr;
+    pools_.clear();
+    hierarchy_.Clear();
+    spatialIndex_.Clear();
+    movedTransforms_.clear();
+    tagIndex_.clear();
+    nameIndex_.clear();
+    currentCamera_ = nullptr;
+
+    teardownCursor_ = 0;
+    loadState_ = LoadState::TearingDown;
+}
+
+bool Scene::TeardownStep(std::chrono::steady_clock::time_point deadline)
+{
+    // Reading the clock for every object would cost more than releasing small ones
+    constexpr size_t kClockInterval = 32;
+    size_t processed = 0;
+    auto outOfTime = [&processed, deadline]
+    {
+        return ++processed % kClockInterval == 0 && std::chrono::steady_clock::now() >= deadline;
+    };
+
+    do
+    {
+        while (teardownCursor_ < objects_.size())
+        {
+            GameObject *object = objects_[teardownCursor_++].get();
+            if (object)
+            {
+                if (object->IsMounted() && !object->IsDestroyed())
+                    object->Disable();
+                object->OnDestroy();
+            }
+            if (outOfTime())
+                return false;
+        }
+    } while (TakeSpawnQueue()); // OnDestroy() may have created objects
+
+    while (!objects_.empty())
+    {
+        objects_.pop_back();
+        if (outOfTime())
+            return false;
+    }
+
+    teardownCursor_ = 0;
+    loadState_ = LoadState::Unloaded;
+    return true;
+}
+
+void Scene::FinishTeardown()
+{
+    if (loadState_ == LoadState::TearingDown)
+        TeardownStep(std::chrono::steady_clock::time_point::max());
+}
+
+bool Scene::TakeSpawnQueue()
+{
+    std::lock_guard<std::mutex> lock(structureMutex_);
+    if (spawnQueue_.empty())
+        return false;
+
+    objects_.insert(objects_.end(),
+                    std::make_move_iterator(spawnQueue_.begin()),
+                    std::make_move_iterator(spawnQueue_.end()));
+    spawnQueue_.clear();
+    return true;
 }
 
 void Scene::Draw()
@@ -23,26 +281,257 @@ void Scene::Draw()
     // TODO: Implement Draw logic
 }
 
+void Scene::UpdateTransforms()
+{
+    if (hierarchy_.IsStructureDirty())
+    {
+        std::vector<TransformComponent *> roots;
+        roots.reserve(objects_.size());
+        for (const auto &object : objects_)
+        {
+            if (object && !object->GetParent())
+                roots.push_back(object->transform_);
+        }
+        hierarchy_.Rebuild(roots);
+    }
+
+    movedTransforms_.clear();
+    hierarchy_.Update(movedTransforms_);
+
+    // Only objects that moved are re-indexed
+    for (TransformComponent *transform : movedTransforms_)
+    {
+        GameObject *object = transform->GetOwner();
+        if (!object || object->isDestroyed_)
+            continue;
+
+        const glm::vec2 position(transform->GetWorldPosition());
+        if (object->spatialHandle_ == InvalidQuadtreeHandle)
+            object->spatialHandle_ = spatialIndex_.Insert(object, position, position);
+        else
+            spatialIndex_.Update(object->spatialHandle_, position, position);
+        renderQueue_.MarkMoved(*object);
+    }
+}
+
+size_t Scene::QueryRect(const glm::vec2 &min, const glm::vec2 &max, std::vector<GameObject *> &out) const
+{
+    out.clear();
+    spatialIndex_.Query(min, max, [&out](GameObject *object, const glm::vec2 &, const glm::vec2 &)
+                        {
+                            if (object->IsEnabled())
+                                out.push_back(object);
+                        });
+    return out.size();
+}
+
+size_t Scene::QueryRadius(const glm::vec2 &center, float radius, std::vector<GameObject *> &out) const
+{
+    out.clear();
+    spatialIndex_.QueryRadius(center, radius, [&out](GameObject *object, const glm::vec2 &, const glm::vec2 &)
+                              {
+                                  if (object->IsEnabled())
+                                      out.push_back(object);
+                              });
+    return out.size();
+}
+
+void Scene::SetSpatialBounds(const glm::vec2 &center, float halfSize, uint32_t maxDepth)
+{
+    renderQueue_.SetBounds(center, halfSize, maxDepth);
+    spatialIndex_.Reset(center, halfSize, maxDepth);
+    for (const auto &object : objects_)
+    {
+        if (!object || object->spatialHandle_ == InvalidQuadtreeHandle)
+            continue;
+
+        const glm::vec2 position(object->transform_->GetWorldPosition());
+        object->spatialHandle_ = spatialIndex_.Insert(object.get(), position, position);
+    }
+}
+
 GameObject *Scene::CreateGameObject()
 {
     auto newObject = std::make_unique<GameObject>(*this);
     GameObject *rawPtr = newObject.get();
+
+    std::lock_guard<std::mutex> lock(structureMutex_);
     spawnQueue_.emplace_back(std::move(newObject));
     return rawPtr;
 }
 
+GameObject *Scene::Instantiate(const Prefab &prefab, const glm::vec3 &position)
+{
+    return Instantiate(prefab, 1, std::span<const glm::vec3>(&position, 1)).front();
+}
+
+std::vector<GameObject *> Scene::Instantiate(const Prefab &prefab, size_t count, std::span<const glm::vec3> positions)
+{
+    std::vector<GameObject *> result;
+    if (count == 0)
+        return result;
+
+    // One allocation holds the components of the whole batch
+    ComponentBlock *block = prefab.AllocateBlock(count);
+
+    std::vector<std::unique_ptr<GameObject>> created;
+    created.reserve(count);
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto object = prefab.CreateInstance(*this, *block, i);
+        if (i < positions.size())
+            object->transform_->SetPosition(positions[i]);
+
+        result.push_back(object.get());
+        created.push_back(std::move(object));
+    }
+
+    std::lock_guard<std::mutex> lock(structureMutex_);
+    spawnQueue_.insert(spawnQueue_.end(),
+                       std::make_move_iterator(created.begin()),
+                       std::make_move_iterator(created.end()));
+    return result;
+}
+
+bool Scene::SaveToFile(const std::string &path) const
+{
+    return SceneSerializer(ctx_).Save(*this, path);
+}
+
+std::vector<GameObject *> Scene::LoadFromFile(const std::string &path)
+{
+    return SceneSerializer(ctx_).Load(*this, path);
+}
+
+ObjectPool *Scene::CreatePool(const Prefab &prefab, size_t initialSize)
+{
+    auto pool = std::make_unique<ObjectPool>(prefab);
+    ObjectPool *rawPool = pool.get();
+    pools_.emplace_back(std::move(pool));
+
+    if (initialSize == 0)
+        return rawPool;
+
+    // Pre-created objects are mounted straight into the scene, disabled and
+    // flagged as destroyed, so every system skips them until they are acquired
+    ComponentBlock *block = prefab.AllocateBlock(initialSize);
+    objects_.reserve(objects_.size() + initialSize);
+    rawPool->free_.reserve(initialSize);
+    for (size_t i = 0; i < initialSize; ++i)
+    {
+        auto object = prefab.CreateInstance(*this, *block, i);
+        object->pool_ = rawPool;
+        object->Mounted();
+        object->Disable();
+        object->MarkAsDestroyed();
+
+        rawPool->free_.push_back(object.get());
+        objects_.emplace_back(std::move(object));
+    }
+    rawPool->size_ = initialSize;
+    hierarchy_.MarkStructureDirty();
+    return rawPool;
+}
+
+GameObject *Scene::Acquire(ObjectPool &pool, const glm::vec3 &position)
+{
+    if (pool.free_.empty())
+    {
+        // Grow by one; the new object spawns with the next batch like any other
+        GameObject *object = Instantiate(pool.prefab_, position);
+        object->pool_ = &pool;
+        ++pool.size_;
+        pool.free_.reserve(pool.size_);
+        return object;
+    }
+
+    GameObject *object = pool.free_.back();
+    pool.free_.pop_back();
+
+    // A fresh id, so id-keyed state (e.g. physics contacts) never carries over
+    object->id_ = GameObject::nextId_++;
+    object->isDestroyed_ = false;
+
+    const TransformComponent *prototype = pool.prefab_.GetTransform();
+    TransformComponent *transform = object->transform_;
+    transform->SetMode(prototype->GetMode());
+    transform->SetRotation(prototype->GetRotation());
+    transform->SetScale(prototype->GetScale());
+    transform->SetPosition(position);
+
+    for (const auto &component : object->GetAllComponents())
+        component->OnReset(ctx_);
+
+    IndexObject(*object);
+    for (const auto &component : object->GetAllComponents())
+        RegisterComponent(*component);
+    object->Enable();
+    return object;
+}
+
+void Scene::ReturnToPool(GameObject &object)
+{
+    // Objects destroyed before their first spawn were mounted and indexed since
+    UnindexObject(object);
+    object.MarkAsDestroyed();
+    object.DetachFromHierarchy();
+    for (const auto &component : object.GetAllComponents())
+        UnregisterComponent(*component);
+    object.pool_->free_.push_back(&object);
+}
+
 void Scene::DestroyGameObject(GameObject &object)
 {
+    // Worker threads only record the request; see FlushDeferredDestroys()
+    if (scheduler_.IsRunning())
+    {
+        std::lock_guard<std::mutex> lock(structureMutex_);
+        deferredDestroys_.push_back(&object);
+        return;
+    }
+
+    // The whole scene is being released; see TeardownStep()
+    if (loadState_ == LoadState::TearingDown)
+        return;
+
     // Check if already in destroy queue to avoid duplicates
     for (auto *obj : destroyQueue_)
     {
         if (obj == &object)
             return; // Already queued for destruction
     }
-    
+
+    // Pooled objects stay in the scene while free; don't release them twice
+    if (object.IsPooled() && object.IsDestroyed())
+        return;
+
+    UnindexObject(object);
     object.Disable();
     object.MarkAsDestroyed();
     destroyQueue_.push_back(&object);
+
+    // Children go down with their parent
+    for (GameObject *child : object.GetChildren())
+    {
+        if (child && !child->IsDestroyed())
+            DestroyGameObject(*child);
+    }
+}
+
+void Scene::FlushDeferredDestroys()
+{
+    std::vector<GameObject *> pending;
+    {
+        std::lock_guard<std::mutex> lock(structureMutex_);
+        pending.swap(deferredDestroys_);
+    }
+
+    for (auto *obj : pending)
+    {
+        if (obj && !obj->IsDestroyed())
+            DestroyGameObject(*obj);
+    }
 }
 
 void Scene::EmitMountedEvent()
@@ -67,14 +556,6 @@ void Scene::EmitEnabledEvent()
     }
 }
 
-void Scene::EmitDestroyedEvent()
-{
-    for (auto &object : objects_)
-    {
-        object->Destroy();
-    }
-}
-
 void Scene::EmitDisabledEvent()
 {
     for (auto &object : objects_)
@@ -88,14 +569,7 @@ void Scene::EmitDisabledEvent()
 
 void Scene::EmitFixedUpdateEvent()
 {
-    for (auto &object : objects_)
-    {
-        // Skip destroyed objects
-        if (object && !object->IsDestroyed())
-        {
-            object->FixedUpdate();
-        }
-    }
+    updateBuckets_.FixedUpdate(ctx_);
 }
 
 void Scene::ProcessDestroyQueue()
@@ -107,6 +581,13 @@ void Scene::ProcessDestroyQueue()
     {
         if (!obj)
             continue;
+
+        // Pooled objects keep living in the scene, disabled, until reused
+        if (obj->IsPooled())
+        {
+            ReturnToPool(*obj);
+            continue;
+        }
             
         // Skip if already processed in this batch
         if (processedObjects.find(obj) != processedObjects.end())
@@ -129,6 +610,10 @@ void Scene::ProcessDestroyQueue()
         {
             // Call OnDestroy to execute component cleanup
             obj->OnDestroy();
+            UnindexObject(*obj);
+            obj->DetachFromHierarchy();
+            for (const auto &component : obj->GetAllComponents())
+                UnregisterComponent(*component);
             
             // Remove from objects list
             auto it = std::remove_if(objects_.begin(), objects_.end(),
@@ -147,10 +632,114 @@ void Scene::ProcessSpawnQueue()
         if (obj)
         {
             obj->Mounted();
+            IndexObject(*obj);
+            for (const auto &component : obj->GetAllComponents())
+                RegisterComponent(*component);
             objects_.emplace_back(std::move(obj));
         }
     }
+    if (!spawnQueue_.empty())
+        hierarchy_.MarkStructureDirty();
     spawnQueue_.clear();
 }
 
+namespace
+{
+
+const std::vector<GameObject*> kNoObjects;
+
+void AddToIndex(std::unordered_map<NameId, std::vector<GameObject*>>& index, NameId key, GameObject* object)
+{
+    if (key != InvalidNameId)
+        index[key].push_back(object);
+}
+
+void RemoveFromIndex(std::unordered_map<NameId, std::vector<GameObject*>>& index, NameId key, GameObject* object)
+{
+    if (key == InvalidNameId)
+        return;
+
+    auto it = index.find(key);
+    if (it == index.end())
+        return;
+
+    auto& bucket = it->second;
+    auto pos = std::find(bucket.begin(), bucket.end(), object);
+    if (pos != bucket.end())
+        bucket.erase(pos);
+}
+
+} // namespace
+
+GameObject *Scene::FindByTag(NameId tag) const
+{
+    const auto& matches = FindAllByTag(tag);
+    return matches.empty() ? nullptr : matches.front();
+}
+
+const std::vector<GameObject *> &Scene::FindAllByTag(NameId tag) const
+{
+    auto it = tagIndex_.find(tag);
+    if (it == tagIndex_.end())
+        return kNoObjects;
+    return it->second;
+}
+
+GameObject *Scene::FindByName(NameId name) const
+{
+    auto it = nameIndex_.find(name);
+    if (it == nameIndex_.end() || it->second.empty())
+        return nullptr;
+    return it->second.front();
+}
+
+void Scene::IndexObject(GameObject &object)
+{
+    AddToIndex(tagIndex_, object.GetTagId(), &object);
+    AddToIndex(nameIndex_, object.GetNameId(), &object);
+
+    // Indexed right away, so objects that never move are found too
+    if (object.spatialHandle_ == InvalidQuadtreeHandle)
+    {
+        const glm::vec2 position(object.transform_->GetWorldPosition());
+        object.spatialHandle_ = spatialIndex_.Insert(&object, position, position);
+    }
+}
+
+void Scene::RegisterComponent(Component &component)
+{
+    updateBuckets_.Register(component);
+    renderQueue_.Register(component);
+}
+
+void Scene::UnregisterComponent(Component &component)
+{
+    updateBuckets_.Unregister(component);
+    renderQueue_.Unregister(component);
+}
+
+void Scene::UnindexObject(GameObject &object)
+{
+    RemoveFromIndex(tagIndex_, object.GetTagId(), &object);
+    RemoveFromIndex(nameIndex_, object.GetNameId(), &object);
+
+    if (object.spatialHandle_ != InvalidQuadtreeHandle)
+    {
+        spatialIndex_.Remove(object.spatialHandle_);
+        object.spatialHandle_ = InvalidQuadtreeHandle;
+    }
+}
+
+void Scene::OnTagChanged(GameObject &object, NameId oldTag)
+{
+    RemoveFromIndex(tagIndex_, oldTag, &object);
+    AddToIndex(tagIndex_, object.GetTagId(), &object);
+}
+
+void Scene::OnNameChanged(GameObject &object, NameId oldName)
+{
+    RemoveFromIndex(nameIndex_, oldName, &object);
+    AddToIndex(nameIndex_, object.GetNameId(), &object);
+}
+
 } // namespace Axion
@@ -1,8 +1,14 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <span>
 #include <vector>
 #include <algorithm>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "axion_engine/structure/ContextAware.hpp"
@@ -10,10 +16,20 @@
 #include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
 #include "axion_engine/runtime/components/camera/CameraComponent.hpp"
 #include "axion_engine/platform/window/Window.hpp"
+#include "axion_engine/runtime/classes/pool/ObjectPool.hpp"
+#include "axion_engine/runtime/classes/snapshot/SceneSnapshot.hpp"
+#include "axion_utilities/spatial/LooseQuadtree.hpp"
+#include "SceneStreamer.hpp"
+#include "RenderQueue.hpp"
+#include "TransformHierarchy.hpp"
+#include "UpdateBuckets.hpp"
+#include "UpdateScheduler.hpp"
 
 namespace Axion
 {
 
+class Prefab;
+
 /**
  * @brief Base class for game scenes.
  * 
@@ -38,27 +54,100 @@ class Scene : public ContextAware
 {
     friend class SceneManager;
     friend class PhysicsManager;
+    friend class GameObject;
+    friend class SceneSerializer;
+    friend class SceneSnapshot;
 
 public:
     using ContextAware::ContextAware;
 
-    virtual ~Scene() = default;
+    /** @brief Waits for pending preload jobs and releases their images. */
+    virtual ~Scene();
 
-    /** @brief Updates all GameObjects in the scene. */
+    /**
+     * @brief Updates all GameObjects in the scene.
+     *
+     * Walks the per-type update lists (see UpdateBuckets): serial
+     * IUpdateable updates run first, then pending Start() calls, then the
+     * IParallelUpdateable components on worker threads (see UpdateScheduler),
+     * then budgeted scripts within the script budget.
+     */
     void Tick();
+
+    /**
+     * @brief Sets the time given to budgeted scripts each frame.
+     * @param milliseconds Budget per frame; at least one budgeted script runs every frame
+     * @see ScriptableComponent::SetUpdateBudgeted()
+     */
+    void SetScriptBudget(float milliseconds) { scriptBudgetMs_ = milliseconds; }
+
+    /** @brief Returns the time given to budgeted scripts each frame, in milliseconds. */
+    float GetScriptBudget() const { return scriptBudgetMs_; }
     
     /** @brief Renders all GameObjects in the scene. */
     void Draw();
 
+    /** @brief Resolves dirty world matrices of the whole transform hierarchy. */
+    void UpdateTransforms();
+
     /**
      * @brief Creates a new GameObject in this scene.
      * @return Pointer to the newly created GameObject
+     * @note Safe to call from IParallelUpdateable::ParallelUpdate().
      */
     GameObject* CreateGameObject();
+
+    /**
+     * @brief Creates a GameObject from a prefab.
+     * @param prefab Template to clone
+     * @param position Local position of the instance
+     * @return Pointer to the new GameObject, mounted with the next spawn batch
+     * @note Safe to call from IParallelUpdateable::ParallelUpdate().
+     */
+    GameObject* Instantiate(const Prefab& prefab, const glm::vec3& position);
+
+    /**
+     * @brief Creates several GameObjects from a prefab in one batch.
+     *
+     * The components of all instances share a single allocation and the
+     * instances are queued for spawning together.
+     *
+     * @param prefab Template to clone
+     * @param count Number of instances
+     * @param positions Optional local positions, one per instance; instances
+     *        without one keep the prefab's position
+     * @return Pointers to the new GameObjects
+     * @note Safe to call from IParallelUpdateable::ParallelUpdate().
+     */
+    std::vector<GameObject*> Instantiate(const Prefab& prefab, size_t count, std::span<const glm::vec3> positions = {});
+
+    /**
+     * @brief Creates a pool of recycled GameObjects.
+     * @param prefab Template of the pooled objects; must outlive the scene's objects
+     * @param initialSize Objects created up front, disabled, in a single batch
+     * @return Pool owned by this scene, released with its objects
+     * @note Main thread only.
+     */
+    ObjectPool* CreatePool(const Prefab& prefab, size_t initialSize = 0);
+
+    /**
+     * @brief Takes an object from a pool, or instantiates one if the pool is empty.
+     *
+     * Reused objects get their prefab transform back, Component::OnReset()
+     * on every component, and Start() again on the next frame.
+     *
+     * @param pool Pool created by CreatePool()
+     * @param position Local position of the object
+     * @return Enabled GameObject; return it with GameObject::Destroy()
+     * @note Main thread only.
+     */
+    GameObject* Acquire(ObjectPool& pool, const glm::vec3& position);
     
     /**
      * @brief Marks a GameObject for destruction at frame end.
      * @param object The GameObject to destroy
+     * @note Safe to call from IParallelUpdateable::ParallelUpdate(); the
+     *       request is then applied on the main thread after the parallel pass.
      */
     void DestroyGameObject(GameObject& object);
 
@@ -72,6 +161,124 @@ public:
         return ptrs;
     }
 
+    /**
+     * @brief Finds the first live GameObject with the given tag.
+     * @param tag Tag to search for
+     * @return Pointer to the GameObject, or nullptr if none is tagged
+     */
+    GameObject* FindByTag(std::string_view tag) const { return FindByTag(NameRegistry::Find(tag)); }
+
+    /** @brief Finds the first live GameObject with the given interned tag. */
+    GameObject* FindByTag(NameId tag) const;
+
+    /**
+     * @brief Returns all live GameObjects with the given tag.
+     * @param tag Tag to search for
+     * @return Cached list owned by the scene; valid until the next spawn/destroy
+     */
+    const std::vector<GameObject*>& FindAllByTag(std::string_view tag) const { return FindAllByTag(NameRegistry::Find(tag)); }
+
+    /** @brief Returns all live GameObjects with the given interned tag. */
+    const std::vector<GameObject*>& FindAllByTag(NameId tag) const;
+
+    /**
+     * @brief Finds the first live GameObject with the given name.
+     * @param name Name to search for
+     * @return Pointer to the GameObject, or nullptr if not found
+     */
+    GameObject* FindByName(std::string_view name) const { return FindByName(NameRegistry::Find(name)); }
+
+    /** @brief Finds the first live GameObject with the given interned name. */
+    GameObject* FindByName(NameId name) const;
+
+    /**
+     * @brief Collects the enabled GameObjects whose world position lies in a rectangle.
+     *
+     * Backed by a loose quadtree that Scene keeps up to date while resolving
+     * transforms, so only objects that moved are re-indexed. Positions are
+     * the ones resolved at the end of the last update: objects spawned this
+     * frame show up from the next one.
+     *
+     * @param min Lower corner (world X/Y)
+     * @param max Upper corner (world X/Y)
+     * @param out Cleared, then receives the objects; keep it around to avoid allocations
+     * @return Number of objects found
+     * @note Read-only: safe to call from IParallelUpdateable::ParallelUpdate().
+     */
+    size_t QueryRect(const glm::vec2& min, const glm::vec2& max, std::vector<GameObject*>& out) const;
+
+    /**
+     * @brief Collects the enabled GameObjects whose world position lies within a radius.
+     * @see QueryRect()
+     */
+    size_t QueryRadius(const glm::vec2& center, float radius, std::vector<GameObject*>& out) const;
+
+    /**
+     * @brief Returns the scene's renderables, sorted for drawing (see RenderQueue).
+     * @note Used by RenderManager; main thread only.
+     */
+    RenderQueue& GetRenderQueue() { return renderQueue_; }
+
+    /**
+     * @brief Sets the area covered by the spatial index and re-indexes every object.
+     *
+     * Objects outside the area are still found, but all of them are tested
+     * by every query. Cells stop splitting after @p maxDepth levels. The
+     * render queue's culling tree covers the same area.
+     *
+     * @param center Center of the indexed area
+     * @param halfSize Half the side of the indexed square
+     * @param maxDepth Subdivision levels (at most 15)
+     */
+    void SetSpatialBounds(const glm::vec2& center, float halfSize, uint32_t maxDepth = 8);
+
+    /**
+     * @brief Starts streaming chunks of content around the current camera.
+     *
+     * Replaces any previous streamer. Streaming stops when the scene exits.
+     *
+     * @param config Chunk size, load/unload radii and per-frame commit budget
+     * @param generator Fills each chunk's blueprint on a worker thread
+     * @return The streamer, owned by this scene
+     */
+    SceneStreamer* EnableStreaming(const StreamingConfig& config, SceneStreamer::ChunkGenerator generator);
+
+    /** @brief Stops streaming; chunks already committed stay in the scene. */
+    void DisableStreaming() { streamer_.reset(); }
+
+    /** @brief Returns the active streamer, or nullptr. */
+    SceneStreamer* GetStreamer() const { return streamer_.get(); }
+
+    /**
+     * @brief Writes the scene's live objects to a binary scene file.
+     * @param path Destination file
+     * @return False if the file could not be written
+     * @note Main thread only. See SceneSerializer.
+     */
+    bool SaveToFile(const std::string& path) const;
+
+    /**
+     * @brief Adds the objects of a binary scene file to this scene.
+     * @param path File written by SaveToFile()
+     * @return The loaded objects, mounted with the next spawn batch; empty on failure
+     * @note Main thread only. See SceneSerializer.
+     */
+    std::vector<GameObject*> LoadFromFile(const std::string& path);
+
+    /**
+     * @brief Captures the state of the scene's live objects.
+     * @param snapshot Receives the state; its buffer is reused
+     * @note Main thread only, outside the update pass.
+     */
+    void CaptureSnapshot(SceneSnapshot& snapshot) const { snapshot.Capture(*this); }
+
+    /**
+     * @brief Writes a captured state back into the objects that still exist.
+     * @return Number of objects restored
+     * @note Main thread only, outside the update pass. Creates and destroys nothing.
+     */
+    size_t RestoreSnapshot(const SceneSnapshot& snapshot) { return snapshot.Restore(*this); }
+
     /** @brief Returns the engine context. */
     EngineContext& GetContext() { return ctx_; }
     
@@ -82,7 +289,21 @@ public:
     glm::vec3 Gravity = glm::vec3(0.0f, 9.81f, 0.0f);
 
 protected:
-    /** @brief Override to set up the scene when it becomes active. */
+    /**
+     * @brief Override to declare the assets the scene needs.
+     *
+     * Runs before OnSceneEnter(). When the scene is preloaded
+     * (SceneManager::Preload()), images requested here with
+     * PreloadTexture() and PreloadAtlasImage() are decoded on worker
+     * threads, and OnSceneEnter() only runs once they are all available.
+     */
+    virtual void OnScenePreload() {}
+
+    /**
+     * @brief Override to set up the scene when it becomes active.
+     * @note A preloaded scene runs this ahead of time, while another scene
+     *       is still current; its objects are mounted right away.
+     */
     virtual void OnSceneEnter() {}
     
     /** @brief Override to clean up when the scene becomes inactive. */
@@ -100,55 +321,114 @@ protected:
      */
     void SetCurrentCamera(CameraComponent* camera) { currentCamera_ = camera; }
 
+    /**
+     * @brief Loads a texture for this scene; call from OnScenePreload().
+     *
+     * While the scene is being preloaded the image is decoded on a worker
+     * thread and the texture is created before OnSceneEnter(). Otherwise the
+     * texture is loaded immediately.
+     *
+     * @param id Texture id in the AssetsManager cache (skipped if already loaded)
+     * @param relativePath Path relative to the assets folder
+     */
+    void PreloadTexture(const std::string& id, const std::string& relativePath);
+
+    /**
+     * @brief Loads an image into a shared atlas for this scene; call from OnScenePreload().
+     *
+     * Images are decoded like PreloadTexture() ones; each atlas is then
+     * packed with AssetsManager::BuildAtlas() before OnSceneEnter(), so its
+     * sprites are ready for GetSprite() there.
+     *
+     * @param atlasId Atlas the image is packed into
+     * @param id Sprite id for AssetsManager::GetSprite() (skipped if already packed)
+     * @param relativePath Path relative to the assets folder
+     */
+    void PreloadAtlasImage(const std::string& atlasId, const std::string& id, const std::string& relativePath);
+
 private:
-    void Enter()
+    enum class LoadState
     {
-        OnSceneEnter();
-        EmitMountedEvent();
-        EmitEnabledEvent();
-    }
+        Unloaded,
+        Preloading,  ///< Images decoding on workers, OnSceneEnter() not run yet
+        Preloaded,   ///< Objects built and mounted, waiting to become current
+        Active,
+        TearingDown  ///< Objects being released over several frames
+    };
 
-    void Exit()
+    struct PendingTexture
     {
-        OnSceneExit();
-        EmitDisabledEvent();
-        EmitDestroyedEvent();
-    }
+        std::string id;
+        std::string path;
+        std::string atlasId; // Empty for plain textures
+        SDL_Surface* surface = nullptr;
+    };
+
+    void Enter();
+    void Exit();
+
+    // Preloading (see SceneManager::Preload())
+    void BeginPreload();
+    bool UpdatePreload(bool block);
+    void BuildPreloadedAtlases();
+
+    // Amortized teardown in two phases: every object's callbacks run before
+    // any object is freed, so OnDestroy() may still reach other objects
+    void BeginTeardown();
+    bool TeardownStep(std::chrono::steady_clock::time_point deadline);
+    void FinishTeardown();
+    bool TakeSpawnQueue();
 
     void EmitMountedEvent();
     void EmitEnabledEvent();
-    void EmitDestroyedEvent();
     void EmitDisabledEvent();
     void EmitFixedUpdateEvent();
 
     void ProcessDestroyQueue();
     void ProcessSpawnQueue();
-    
-    void ClearAllObjects()
-    {
-        // Destroy objects in spawn queue that never made it to the scene
-        for (auto& obj : spawnQueue_)
-        {
-            if (obj)
-                obj->OnDestroy();
-        }
-        spawnQueue_.clear();
-        destroyQueue_.clear();
-        
-        for (auto& obj : objects_)
-        {
-            if (obj)
-                obj->OnDestroy();
-        }
-        objects_.clear();
-        currentCamera_ = nullptr;
-    }
+    void FlushDeferredDestroys();
+    void ReturnToPool(GameObject& object);
 
+    // Update and render registration of a mounted component
+    void RegisterComponent(Component& component);
+    void UnregisterComponent(Component& component);
+
+    // Tag/name/spatial index maintenance
+    void IndexObject(GameObject& object);
+    void UnindexObject(GameObject& object);
+    void OnTagChanged(GameObject& object, NameId oldTag);
+    void OnNameChanged(GameObject& object, NameId oldName);
+    
     std::vector<std::unique_ptr<GameObject>> objects_;
     std::vector<std::unique_ptr<GameObject>> spawnQueue_;
     std::vector<GameObject*> destroyQueue_;
+    std::vector<std::unique_ptr<ObjectPool>> pools_;
+
+    UpdateBuckets updateBuckets_;
+    RenderQueue renderQueue_;
+    float scriptBudgetMs_ = 1.0f;
+
+    // Parallel updates; worker threads may only touch the queues under structureMutex_
+    UpdateScheduler scheduler_;
+    std::mutex structureMutex_;
+    std::vector<GameObject*> deferredDestroys_;
+
+    TransformHierarchy hierarchy_;
+    LooseQuadtree<GameObject*> spatialIndex_;
+    std::vector<TransformComponent*> movedTransforms_;
+    std::unique_ptr<SceneStreamer> streamer_;
+
+    using ObjectIndex = std::unordered_map<NameId, std::vector<GameObject*>>;
+    ObjectIndex tagIndex_;
+    ObjectIndex nameIndex_;
 
     CameraComponent* currentCamera_ = nullptr;
+
+    LoadState loadState_ = LoadState::Unloaded;
+    std::vector<std::unique_ptr<PendingTexture>> pendingTextures_;
+    std::vector<std::string> preloadAtlases_; // Atlas ids to build, in request order
+    JobCounter preloadJobs_;
+    size_t teardownCursor_ = 0; // Objects whose callbacks already ran
 };
 
 } // namespace Axion
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include "SceneStreamer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+
+#include "Scene.hpp"
+#include "axion_engine/managers/assets/AssetsManager.hpp"
+#include "axion_engine/runtime/classes/prefab/Prefab.hpp"
+
+namespace Axion
+{
+
+ChunkBlueprint::~ChunkBlueprint()
+{
+    // Surfaces of chunks unloaded before their commit
+    for (auto& texture : textures_)
+    {
+        if (texture.surface)
+            SDL_FreeSurface(texture.surface);
+    }
+}
+
+void ChunkBlueprint::LoadTexture(const std::string& id, const std::string& relativePath)
+{
+    if (!assets_ || assets_->GetTexture(id))
+        return;
+
+    if (SDL_Surface* surface = assets_->DecodeSurface(relativePath))
+        textures_.push_back({id, relativePath, surface});
+}
+
+void ChunkBlueprint::AddObject(const glm::vec3& localPosition, ObjectSetup setup)
+{
+    objects_.push_back({nullptr, localPosition, std::move(setup)});
+}
+
+void ChunkBlueprint::AddInstance(const Prefab& prefab, const glm::vec3& localPosition, ObjectSetup setup)
+{
+    objects_.push_back({&prefab, localPosition, std::move(setup)});
+}
+
+SceneStreamer::SceneStreamer(EngineContext& ctx, Scene& scene, const StreamingConfig& config, ChunkGenerator generator)
+    : ContextAware(ctx), scene_(scene), config_(config), generator_(std::move(generator))
+{
+    if (config_.chunkSize <= 0.0f)
+        config_.chunkSize = 1.0f;
+    if (config_.unloadRadius < config_.loadRadius)
+        config_.unloadRadius = config_.loadRadius;
+}
+
+SceneStreamer::~SceneStreamer()
+{
+    // Generators reference the chunks and generator_, let them finish first
+    if (ctx_.jobs)
+        jobs().Wait(inFlight_);
+}
+
+ChunkCoord SceneStreamer::GetChunkAt(const glm::vec3& position) const
+{
+    return {static_cast<int>(std::floor(position.x / config_.chunkSize)),
+            static_cast<int>(std::floor(position.y / config_.chunkSize))};
+}
+
+bool SceneStreamer::IsChunkLoaded(ChunkCoord coord) const
+{
+    auto it = chunks_.find(coord);
+    return it != chunks_.end() && it->second->state == ChunkState::Loaded;
+}
+
+size_t SceneStreamer::GetLoadedChunkCount() const
+{
+    size_t count = 0;
+    for (const auto& [coord, chunk] : chunks_)
+    {
+        if (chunk->state == ChunkState::Loaded)
+            ++count;
+    }
+    return count;
+}
+
+size_t SceneStreamer::GetPendingChunkCount() const
+{
+    return chunks_.size() - GetLoadedChunkCount();
+}
+
+void SceneStreamer::Update()
+{
+    ReleaseCancelled();
+
+    CameraComponent* camera = scene_.GetCurrentCamera();
+    if (!camera || !camera->GetOwner() || !camera->GetOwner()->GetTransform())
+        return;
+
+    const ChunkCoord center = GetChunkAt(camera->GetOwner()->GetTransform()->GetWorldPosition());
+
+    // Unload first, so chunks that left the area stop competing for the budget
+    for (auto it = chunks_.begin(); it != chunks_.end();)
+    {
+        const ChunkCoord c = it->first;
+        const int distance = std::max(std::abs(c.x - center.x), std::abs(c.y - center.y));
+        if (distance > config_.unloadRadius)
+        {
+            auto next = std::next(it);
+            UnloadChunk(it);
+            it = next;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // Request missing chunks, inner rings first
+    for (int ring = 0; ring <= config_.loadRadius; ++ring)
+    {
+        for (int y = -ring; y <= ring; ++y)
+        {
+            for (int x = -ring; x <= ring; ++x)
+            {
+                if (std::max(std::abs(x), std::abs(y)) != ring)
+                    continue;
+
+                const ChunkCoord coord{center.x + x, center.y + y};
+                if (chunks_.find(coord) == chunks_.end())
+                    RequestChunk(coord);
+            }
+        }
+    }
+
+    CommitChunks(center);
+}
+
+void SceneStreamer::RequestChunk(ChunkCoord coord)
+{
+    const glm::vec2 origin(coord.x * config_.chunkSize, coord.y * config_.chunkSize);
+    auto chunk = std::make_unique<Chunk>(coord, origin, ctx_.assets);
+    Chunk* raw = chunk.get();
+    chunks_.emplace(coord, std::move(chunk));
+
+    if (!ctx_.jobs)
+    {
+        // No job system (e.g. a scene driven outside of Engine): generate inline
+        generator_(raw->blueprint);
+        raw->generated.store(true, std::memory_order_release);
+        return;
+    }
+
+    jobs().Submit([this, raw]
+    {
+        generator_(raw->blueprint);
+        raw->generated.store(true, std::memory_order_release);
+    }, &inFlight_);
+}
+
+void SceneStreamer::UnloadChunk(std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>, ChunkCoordHash>::iterator it)
+{
+    std::unique_ptr<Chunk> chunk = std::move(it->second);
+    chunks_.erase(it);
+
+    // Destroying the root takes every committed object of the chunk with it
+    if (chunk->root && !chunk->root->IsDestroyed())
+        chunk->root->Destroy();
+
+    if (chunk->state == ChunkState::Generating && !chunk->generated.load(std::memory_order_acquire))
+        cancelled_.push_back(std::move(chunk)); // Freed once its generator returns
+}
+
+void SceneStreamer::ReleaseCancelled()
+{
+    cancelled_.erase(std::remove_if(cancelled_.begin(), cancelled_.end(),
+                                    [](const std::unique_ptr<Chunk>& chunk)
+                                    { return chunk->generated.load(std::memory_order_acquire); }),
+                     cancelled_.end());
+}
+
+void SceneStreamer::CommitChunks(ChunkCoord center)
+{
+    using Clock = std::chrono::high_resolution_clock;
+    const auto start = Clock::now();
+    const auto budget = std::chrono::duration<float, std::milli>(config_.commitBudgetMs);
+
+    // Generated chunks, nearest to the camera first
+    commitOrder_.clear();
+    for (auto& [coord, chunk] : chunks_)
+    {
+        if (chunk->state == ChunkState::Generating && chunk->generated.load(std::memory_order_acquire))
+            chunk->state = ChunkState::Committing;
+        if (chunk->state == ChunkState::Committing)
+            commitOrder_.push_back(chunk.get());
+    }
+    if (commitOrder_.empty())
+        return;
+
+    auto distance = [center](const Chunk* chunk)
+    {
+        const ChunkCoord c = chunk->blueprint.GetCoord();
+        return std::max(std::abs(c.x - center.x), std::abs(c.y - center.y));
+    };
+    std::sort(commitOrder_.begin(), commitOrder_.end(),
+              [&distance](const Chunk* a, const Chunk* b) { return distance(a) < distance(b); });
+
+    for (Chunk* chunk : commitOrder_)
+    {
+        // At least one step per frame, so streaming always makes progress
+        while (CommitStep(*chunk))
+        {
+            if (Clock::now() - start >= budget)
+                return;
+        }
+        chunk->state = ChunkState::Loaded;
+
+        if (Clock::now() - start >= budget)
+            return;
+    }
+}
+
+bool SceneStreamer::CommitStep(Chunk& chunk)
+{
+    ChunkBlueprint& blueprint = chunk.blueprint;
+
+    if (!chunk.root)
+    {
+        chunk.root = scene_.CreateGameObject();
+        chunk.root->GetTransform()->SetPosition({blueprint.origin_.x, blueprint.origin_.y, 0.0f});
+        return true;
+    }
+
+    if (chunk.nextTexture < blueprint.textures_.size())
+    {
+        auto& texture = blueprint.textures_[chunk.nextTexture++];
+        assets().CreateTexture(texture.id, texture.surface, texture.path);
+        texture.surface = nullptr;
+        return true;
+    }
+
+    if (chunk.nextObject < blueprint.objects_.size())
+    {
+        auto& pending = blueprint.objects_[chunk.nextObject++];
+        GameObject* object = pending.prefab
+                                 ? scene_.Instantiate(*pending.prefab, pending.position)
+                                 : scene_.CreateGameObject();
+        if (!pending.prefab)
+            object->GetTransform()->SetPosition(pending.position);
+        object->SetParent(chunk.root);
+
+        if (pending.setup)
+            pending.setup(*object, ctx_);
+        pending.setup = nullptr; // Release captures early
+        return chunk.nextObject < blueprint.objects_.size();
+    }
+
+    return false;
+}
+
+} // namespace Axion
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include "axion_engine/structure/ContextAware.hpp"
+#include "axion_engine/core/jobs/JobSystem.hpp"
+
+namespace Axion
+{
+
+class AssetsManager;
+class GameObject;
+class Prefab;
+class Scene;
+
+/** @brief Integer coordinates of a streaming chunk on the chunk grid. */
+struct ChunkCoord
+{
+    int x = 0;
+    int y = 0;
+
+    bool operator==(const ChunkCoord& other) const { return x == other.x && y == other.y; }
+};
+
+/** @brief Hash for ChunkCoord keys. */
+struct ChunkCoordHash
+{
+    size_t operator()(const ChunkCoord& c) const
+    {
+        return std::hash<uint64_t>()((static_cast<uint64_t>(static_cast<uint32_t>(c.x)) << 32) |
+                                     static_cast<uint32_t>(c.y));
+    }
+};
+
+/**
+ * @brief Content of one chunk, described on a worker thread.
+ *
+ * A ChunkGenerator fills the blueprint off the main thread: images are
+ * decoded right away, objects are only recorded. SceneStreamer later creates
+ * the textures and objects on the main thread, a few per frame.
+ *
+ * Object positions are relative to the chunk origin (see GetOrigin()); the
+ * objects are parented to a per-chunk root placed there.
+ */
+class ChunkBlueprint
+{
+public:
+    /** Called on the main thread once the object exists. */
+    using ObjectSetup = std::function<void(GameObject& object, EngineContext& context)>;
+
+    ChunkBlueprint(ChunkCoord coord, glm::vec2 origin, AssetsManager* assets)
+        : coord_(coord), origin_(origin), assets_(assets) {}
+    ~ChunkBlueprint();
+
+    ChunkBlueprint(const ChunkBlueprint&) = delete;
+    ChunkBlueprint& operator=(const ChunkBlueprint&) = delete;
+
+    /** @brief Returns the chunk's grid coordinates. */
+    ChunkCoord GetCoord() const { return coord_; }
+
+    /** @brief Returns the world position of the chunk origin (its minimum corner). */
+    glm::vec2 GetOrigin() const { return origin_; }
+
+    /**
+     * @brief Decodes an image now; its texture is created when the chunk is committed.
+     * @param id Texture id in the AssetsManager cache (skipped if already loaded)
+     * @param relativePath Path relative to the assets folder
+     */
+    void LoadTexture(const std::string& id, const std::string& relativePath);
+
+    /**
+     * @brief Records an empty GameObject.
+     * @param localPosition Position relative to the chunk origin
+     * @param setup Adds components to the object on the main thread
+     */
+    void AddObject(const glm::vec3& localPosition, ObjectSetup setup);
+
+    /**
+     * @brief Records a prefab instance.
+     * @param prefab Template to instantiate; must outlive the streamer
+     * @param localPosition Position relative to the chunk origin
+     * @param setup Optional per-instance tweaks on the main thread
+     */
+    void AddInstance(const Prefab& prefab, const glm::vec3& localPosition, ObjectSetup setup = nullptr);
+
+    /** @brief Returns the number of recorded objects. */
+    size_t GetObjectCount() const { return objects_.size(); }
+
+private:
+    friend class SceneStreamer;
+
+    struct PendingTexture
+    {
+        std::string id;
+        std::string path;
+        SDL_Surface* surface = nullptr;
+    };
+
+    struct PendingObject
+    {
+        const Prefab* prefab = nullptr;
+        glm::vec3 position{0.0f};
+        ObjectSetup setup;
+    };
+
+    ChunkCoord coord_;
+    glm::vec2 origin_;
+    AssetsManager* assets_;
+
+    std::vector<PendingTexture> textures_;
+    std::vector<PendingObject> objects_;
+};
+
+/** @brief Settings of a SceneStreamer. */
+struct StreamingConfig
+{
+    float chunkSize = 1024.0f;   ///< Side of a square chunk in world units
+    int loadRadius = 1;          ///< Chunks within this distance (in chunks) of the camera are loaded
+    int unloadRadius = 2;        ///< Chunks beyond this distance are unloaded (>= loadRadius)
+    float commitBudgetMs = 2.0f; ///< Main-thread time per frame for creating textures and objects
+};
+
+/**
+ * @brief Streams additive chunks of content around the camera.
+ *
+ * The world is a grid of square chunks. Each frame the streamer requests the
+ * chunks within StreamingConfig::loadRadius of the scene's current camera:
+ * their blueprints are built by the generator on the JobSystem, then
+ * committed to the scene incrementally, never spending much more than
+ * StreamingConfig::commitBudgetMs per frame. Chunks past unloadRadius are
+ * destroyed (the gap between both radii avoids thrashing at chunk borders).
+ *
+ * Created with Scene::EnableStreaming() and driven by Scene::Tick().
+ *
+ * @par Usage:
+ * @code
+ * EnableStreaming({512.0f, 1, 2, 2.0f}, [this](ChunkBlueprint& chunk) {
+ *     chunk.LoadTexture("Grass", "grass.png");
+ *     chunk.AddObject({256.0f, 256.0f, -0.5f}, [](GameObject& tile, EngineContext& ctx) {
+ *         tile.AddComponent<SpriteRenderComponent>()->SetTexture(ctx.assetProvider->GetTexture("Grass"));
+ *     });
+ *     for (const glm::vec3& p : ScatterRocks(chunk.GetCoord()))
+ *         chunk.AddInstance(rockPrefab, p);
+ * });
+ * @endcode
+ *
+ * @note The generator runs on worker threads: it must only fill the blueprint.
+ */
+class SceneStreamer : public ContextAware
+{
+public:
+    /** Fills a chunk's blueprint; runs on a worker thread. */
+    using ChunkGenerator = std::function<void(ChunkBlueprint& chunk)>;
+
+    SceneStreamer(EngineContext& ctx, Scene& scene, const StreamingConfig& config, ChunkGenerator generator);
+
+    /** @brief Waits for in-flight generators; committed objects are left to the scene. */
+    ~SceneStreamer();
+
+    SceneStreamer(const SceneStreamer&) = delete;
+    SceneStreamer& operator=(const SceneStreamer&) = delete;
+
+    /** @brief Requests, commits and unloads chunks around the current camera. */
+    void Update();
+
+    /** @brief Returns the chunk containing a world position. */
+    ChunkCoord GetChunkAt(const glm::vec3& position) const;
+
+    /** @brief Returns true if the chunk is fully committed. */
+    bool IsChunkLoaded(ChunkCoord coord) const;
+
+    /** @brief Returns the number of fully committed chunks. */
+    size_t GetLoadedChunkCount() const;
+
+    /** @brief Returns the number of chunks being generated or committed. */
+    size_t GetPendingChunkCount() const;
+
+    /** @brief Returns the settings. */
+    const StreamingConfig& GetConfig() const { return config_; }
+
+private:
+    enum class ChunkState
+    {
+        Generating, ///< Blueprint being built on a worker
+        Committing, ///< Textures and objects being created on the main thread
+        Loaded
+    };
+
+    struct Chunk
+    {
+        Chunk(ChunkCoord c, glm::vec2 origin, AssetsManager* assets) : blueprint(c, origin, assets) {}
+
+        ChunkBlueprint blueprint;
+        std::atomic<bool> generated{false};
+        ChunkState state = ChunkState::Generating;
+        GameObject* root = nullptr;
+        size_t nextTexture = 0;
+        size_t nextObject = 0;
+    };
+
+    void RequestChunk(ChunkCoord coord);
+    void UnloadChunk(std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>, ChunkCoordHash>::iterator it);
+    void CommitChunks(ChunkCoord center);
+    bool CommitStep(Chunk& chunk);
+    void ReleaseCancelled();
+
+    Scene& scene_;
+    StreamingConfig config_;
+    ChunkGenerator generator_;
+
+    std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>, ChunkCoordHash> chunks_;
+    std::vector<std::unique_ptr<Chunk>> cancelled_; // Unloaded while still generating
+    std::vector<Chunk*> commitOrder_;
+    JobCounter inFlight_;
+};
+
+} // namespace Axion
@@ -0,0 +1,41 @@
+#include "TransformHierarchy.hpp"
+
+#include "axion_engine/runtime/components/transform/TransformComponent.hpp"
+
+namespace Axion
+{
+
+void TransformHierarchy::Update(std::vector<TransformComponent*>& moved)
+{
+    // Parents precede children, so a parent's world transform is always
+    // resolved before any child reads it.
+    for (TransformComponent* transform : order_)
+    {
+        if (transform->worldDirty_)
+            transform->UpdateWorld();
+
+        // Reported even if a lazy read already resolved the new world state
+        if (transform->movedSinceUpdate_)
+        {
+            transform->movedSinceUpdate_ = false;
+            moved.push_back(transform);
+        }
+    }
+}
+
+void TransformHierarchy::Rebuild(const std::vector<TransformComponent*>& roots)
+{
+    order_.clear();
+    order_.insert(order_.end(), roots.begin(), roots.end());
+
+    // Breadth-first expansion: order_ doubles as the BFS queue
+    for (size_t i = 0; i < order_.size(); ++i)
+    {
+        const auto& children = order_[i]->GetChildren();
+        order_.insert(order_.end(), children.begin(), children.end());
+    }
+
+    structureDirty_ = false;
+}
+
+} // namespace Axion
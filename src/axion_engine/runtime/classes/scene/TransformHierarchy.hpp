@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+
+namespace Axion
+{
+
+class TransformComponent;
+
+/**
+ * @brief Breadth-first flattened view of a scene's transform tree.
+ *
+ * The hierarchy keeps every transform in a single array ordered so that
+ * parents always precede their children. Resolving world matrices is then
+ * one linear pass: each dirty transform combines its parent's (already
+ * resolved) world affine with its local affine, and clean transforms are
+ * skipped. 4x4 world matrices are not touched here; they are built lazily
+ * by TransformComponent::GetWorldMatrix().
+ *
+ * The flattened order is rebuilt lazily, only after the structure changed
+ * (spawn, destroy or re-parenting).
+ */
+class TransformHierarchy
+{
+public:
+    /** @brief Flags the flattened order for rebuild before the next update. */
+    void MarkStructureDirty() { structureDirty_ = true; }
+
+    /**
+     * @brief Rebuilds the flattened order from the given roots.
+     * @param roots Root transforms (transforms without a parent)
+     */
+    void Rebuild(const std::vector<TransformComponent*>& roots);
+
+    /**
+     * @brief Resolves all dirty world matrices in one linear pass.
+     * @param moved Receives the transforms whose world transform changed since the last update,
+     *        including those already resolved by a lazy read
+     */
+    void Update(std::vector<TransformComponent*>& moved);
+
+    /** @brief Returns the flattened, breadth-first transform order. */
+    const std::vector<TransformComponent*>& GetOrder() const { return order_; }
+
+    /** @brief Clears the flattened order. */
+    void Clear()
+    {
+        order_.clear();
+        structureDirty_ = true;
+    }
+
+    /** @brief Returns true if the order must be rebuilt. */
+    bool IsStructureDirty() const { return structureDirty_; }
+
+private:
+    std::vector<TransformComponent*> order_;
+    bool structureDirty_ = true;
+};
+
+} // namespace Axion
@@ -0,0 +1,297 @@
+#include "UpdateBuckets.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "UpdateScheduler.hpp"
+#include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
+
+namespace Axion
+{
+
+namespace
+{
+
+bool GetBit(const std::vector<uint64_t>& mask, size_t index)
+{
+    return (mask[index / 64] >> (index % 64)) & 1u;
+}
+
+void SetBit(std::vector<uint64_t>& mask, size_t index, bool value)
+{
+    const uint64_t bit = uint64_t{1} << (index % 64);
+    if (value)
+        mask[index / 64] |= bit;
+    else
+        mask[index / 64] &= ~bit;
+}
+
+} // namespace
+
+void UpdateBuckets::Register(Component& component)
+{
+    if (component.updateState_ != Component::UpdateState::None)
+        return;
+
+    UpdateEntry entry;
+    entry.component = &component;
+    entry.updateable = dynamic_cast<IUpdateable*>(&component);
+    entry.parallel = dynamic_cast<IParallelUpdateable*>(&component);
+    if (!entry.updateable && !entry.parallel)
+        return;
+
+    // Pooled objects register again when reused: their timing starts over
+    entry.script = dynamic_cast<ScriptableComponent*>(&component);
+    if (entry.script)
+    {
+        entry.script->phase_ = nextPhase_++;
+        entry.script->ResetTiming();
+    }
+
+    component.updateState_ = Component::UpdateState::PendingStart;
+    pendingStart_.push_back(entry);
+}
+
+void UpdateBuckets::Unregister(Component& component)
+{
+    switch (component.updateState_)
+    {
+    case Component::UpdateState::None:
+        return;
+
+    case Component::UpdateState::PendingStart:
+    {
+        auto it = std::find_if(pendingStart_.begin(), pendingStart_.end(),
+                               [&component](const UpdateEntry& e) { return e.component == &component; });
+        if (it != pendingStart_.end())
+            pendingStart_.erase(it);
+        break;
+    }
+
+    case Component::UpdateState::Active:
+    {
+        UpdateList& list = buckets_[component.updateBucket_].list;
+        auto& entries = list.entries;
+        const uint32_t index = component.updateIndex_;
+        const size_t last = entries.size() - 1;
+
+        if (ScriptableComponent* script = entries[index].script)
+            RemoveBudgeted(*script);
+
+        // Swap-remove: move the last entry (and its bit) into the freed slot
+        if (index != last)
+        {
+            entries[index] = entries.back();
+            entries[index].component->updateIndex_ = index;
+            SetBit(list.active, index, GetBit(list.active, last));
+        }
+        SetBit(list.active, last, false);
+        entries.pop_back();
+        list.active.resize((entries.size() + 63) / 64);
+        break;
+    }
+    }
+
+    component.updateState_ = Component::UpdateState::None;
+}
+
+void UpdateBuckets::SetActive(Component& component, bool active)
+{
+    if (component.updateState_ != Component::UpdateState::Active)
+        return; // Pending entries get their bit when they are inserted
+
+    UpdateList& list = buckets_[component.updateBucket_].list;
+    SetBit(list.active, component.updateIndex_, active);
+
+    // The time spent disabled does not count as a long update delta
+    if (ScriptableComponent* script = list.entries[component.updateIndex_].script)
+        script->ResetTiming();
+}
+
+void UpdateBuckets::Update(EngineContext& context, UpdateScheduler& scheduler)
+{
+    clock_.deltaTime = context.timeProvider ? context.timeProvider->GetDeltaTime() : 0.0f;
+    clock_.time += clock_.deltaTime;
+    ++clock_.frame;
+
+    for (auto& bucket : buckets_)
+    {
+        const UpdateList& list = bucket.list;
+        if (list.entries.empty())
+            continue;
+
+        if (bucket.parallel)
+        {
+            scheduler.AddSystem(bucket.type, list);
+            continue;
+        }
+
+        list.ForEachActive(0, list.entries.size(),
+                           [this, &context](const UpdateEntry& entry)
+                           {
+                               if (clock_.Admit(entry))
+                                   entry.updateable->Update(context);
+                           });
+    }
+}
+
+void UpdateBuckets::RunBudgeted(EngineContext& context, float budgetMs)
+{
+    if (budgeted_.empty())
+        return;
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                              std::chrono::duration<float, std::milli>(budgetMs));
+
+    // Each script runs at most once per frame; the next frame resumes where this one stopped
+    const size_t count = budgeted_.size();
+    for (size_t visited = 0; visited < count && !budgeted_.empty(); ++visited)
+    {
+        if (budgetCursor_ >= budgeted_.size())
+            budgetCursor_ = 0;
+
+        // Copied: the callback may remove entries from the list
+        const UpdateEntry entry = budgeted_[budgetCursor_++];
+        if (!entry.component->IsActive())
+            continue;
+
+        entry.script->Stamp(clock_.time, clock_.deltaTime);
+        if (entry.parallel)
+            entry.parallel->ParallelUpdate(context);
+        else
+            entry.updateable->Update(context);
+
+        if (std::chrono::steady_clock::now() >= deadline)
+            break;
+    }
+}
+
+void UpdateBuckets::RefreshBudgeted(ScriptableComponent& script)
+{
+    const bool budgeted = script.frequency_ == UpdateFrequency::Budgeted &&
+                          script.updateState_ == Component::UpdateState::Active;
+
+    if (budgeted && script.budgetIndex_ == UINT32_MAX)
+        AddBudgeted(buckets_[script.updateBucket_].list.entries[script.updateIndex_]);
+    else if (!budgeted)
+        RemoveBudgeted(script);
+}
+
+void UpdateBuckets::FixedUpdate(EngineContext& context)
+{
+    for (auto& bucket : buckets_)
+    {
+        const UpdateList& list = bucket.list;
+        list.ForEachActive(0, list.entries.size(),
+                           [&context](const UpdateEntry& entry)
+                           {
+                               if (entry.updateable)
+                                   entry.updateable->FixedUpdate(context);
+                           });
+    }
+}
+
+void UpdateBuckets::RunPendingStarts(EngineContext& context)
+{
+    if (pendingStart_.empty())
+        return;
+
+    // Start() may register more components; those wait for the next drain
+    std::vector<UpdateEntry> pending;
+    pending.swap(pendingStart_);
+
+    for (const UpdateEntry& entry : pending)
+    {
+        Component& component = *entry.component;
+        if (component.updateState_ != Component::UpdateState::PendingStart)
+            continue; // Unregistered while waiting
+
+        GameObject* owner = component.GetOwner();
+        if (!owner || owner->IsDestroyed())
+        {
+            component.updateState_ = Component::UpdateState::None;
+            continue;
+        }
+
+        // Disabled objects and components start once they are enabled again
+        if (!owner->IsEnabled() || !component.IsEnabled())
+        {
+            pendingStart_.push_back(entry);
+            continue;
+        }
+
+        if (entry.updateable)
+            entry.updateable->Start(context);
+
+        // Start() may have destroyed the object or unregistered the component
+        if (component.updateState_ == Component::UpdateState::PendingStart)
+            Insert(entry);
+    }
+}
+
+void UpdateBuckets::Clear()
+{
+    for (auto& bucket : buckets_)
+    {
+        for (auto& entry : bucket.list.entries)
+            entry.component->updateState_ = Component::UpdateState::None;
+    }
+    for (auto& entry : pendingStart_)
+        entry.component->updateState_ = Component::UpdateState::None;
+    for (auto& entry : budgeted_)
+        entry.script->budgetIndex_ = UINT32_MAX;
+
+    buckets_.clear();
+    lookup_.clear();
+    pendingStart_.clear();
+    budgeted_.clear();
+    budgetCursor_ = 0;
+}
+
+void UpdateBuckets::Insert(const UpdateEntry& entry)
+{
+    const std::type_index type(typeid(*entry.component));
+
+    auto it = lookup_.find(type);
+    if (it == lookup_.end())
+    {
+        it = lookup_.emplace(type, static_cast<uint32_t>(buckets_.size())).first;
+        buckets_.push_back({type, entry.parallel != nullptr, {}});
+    }
+
+    UpdateList& list = buckets_[it->second].list;
+    const size_t index = list.entries.size();
+    entry.component->updateState_ = Component::UpdateState::Active;
+    entry.component->updateBucket_ = it->second;
+    entry.component->updateIndex_ = static_cast<uint32_t>(index);
+    list.entries.push_back(entry);
+    list.active.resize((index + 64) / 64);
+    SetBit(list.active, index, entry.component->IsActive());
+
+    if (entry.script && entry.script->frequency_ == UpdateFrequency::Budgeted)
+        AddBudgeted(entry);
+}
+
+void UpdateBuckets::AddBudgeted(const UpdateEntry& entry)
+{
+    entry.script->budgetIndex_ = static_cast<uint32_t>(budgeted_.size());
+    budgeted_.push_back(entry);
+}
+
+void UpdateBuckets::RemoveBudgeted(ScriptableComponent& script)
+{
+    const uint32_t index = script.budgetIndex_;
+    if (index == UINT32_MAX)
+        return;
+
+    if (index + 1 != budgeted_.size())
+    {
+        budgeted_[index] = budgeted_.back();
+        budgeted_[index].script->budgetIndex_ = index;
+    }
+    budgeted_.pop_back();
+    script.budgetIndex_ = UINT32_MAX;
+}
+
+} // namespace Axion
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "axion_engine/core/EngineContext.hpp"
+#include "axion_engine/runtime/interfaces/IUpdateable.hpp"
+#include "axion_engine/runtime/interfaces/IParallelUpdateable.hpp"
+#include "axion_engine/runtime/components/scriptable/ScriptableComponent.hpp"
+
+namespace Axion
+{
+
+class Component;
+class UpdateScheduler;
+
+/**
+ * @brief One updateable component, with its interfaces resolved once.
+ */
+struct UpdateEntry
+{
+    Component* component = nullptr;
+    IUpdateable* updateable = nullptr;       ///< Start/Update/FixedUpdate target, may be null
+    IParallelUpdateable* parallel = nullptr; ///< Worker-thread update target, may be null
+    ScriptableComponent* script = nullptr;   ///< Set for scripts, whose update frequency may be lowered
+};
+
+/**
+ * @brief Frame counter and script time of an update pass.
+ *
+ * Decides which scripts are due this frame (see ScriptableComponent's
+ * update frequencies).
+ */
+struct UpdateClock
+{
+    uint64_t frame = 0;
+    double time = 0.0;     ///< Sum of the frame delta times, in seconds
+    float deltaTime = 0.0f;
+
+    /**
+     * @brief Returns true if the entry must be updated this frame, and records the update.
+     * @note Budgeted scripts are never due here; see UpdateBuckets::RunBudgeted().
+     */
+    bool Admit(const UpdateEntry& entry) const
+    {
+        ScriptableComponent* script = entry.script;
+        if (!script)
+            return true;
+
+        switch (script->frequency_)
+        {
+        case UpdateFrequency::EveryFrame:
+            break;
+
+        case UpdateFrequency::EveryNFrames:
+            if ((frame + script->phase_) % script->intervalFrames_ != 0)
+                return false;
+            break;
+
+        case UpdateFrequency::Rate:
+        {
+            // Half a frame of slack, so 10 Hz at 60 fps is every 6 frames rather than 7
+            const double slack = deltaTime * 0.5;
+            if (script->lastUpdate_ < 0.0)
+            {
+                // First update at a per-instance offset within the interval; it reports the frame delta
+                if (script->firstUpdate_ < 0.0)
+                    script->firstUpdate_ = time + script->intervalSeconds_ * ((script->phase_ % 16) / 16.0);
+                if (time + slack < script->firstUpdate_)
+                    return false;
+            }
+            else if (time - script->lastUpdate_ + slack < script->intervalSeconds_)
+            {
+                return false;
+            }
+            break;
+        }
+
+        case UpdateFrequency::Budgeted:
+            return false;
+        }
+
+        script->Stamp(time, deltaTime);
+        return true;
+    }
+};
+
+/**
+ * @brief Dense update list of one component type.
+ *
+ * Bit i of the active mask is set while entry i's component is active
+ * (see Component::IsActive()). It is kept up to date by GameObject and
+ * Component as they are enabled and disabled, so update passes skip
+ * inactive entries 64 at a time instead of checking every owner.
+ */
+struct UpdateList
+{
+    std::vector<UpdateEntry> entries;
+    std::vector<uint64_t> active;
+
+    /**
+     * @brief Calls fn(entry) for every active entry in [begin, end).
+     *
+     * The mask is read again after every call, so an entry disabled by an
+     * earlier callback of the same pass is skipped.
+     */
+    template <typename Fn>
+    void ForEachActive(size_t begin, size_t end, Fn&& fn) const
+    {
+        size_t i = begin;
+        while (i < end)
+        {
+            const uint64_t bits = active[i / 64] >> (i % 64);
+            if (bits == 0)
+            {
+                i = (i / 64 + 1) * 64;
+                continue;
+            }
+
+            i += static_cast<size_t>(std::countr_zero(bits));
+            if (i >= end)
+                break;
+            fn(entries[i]);
+            ++i;
+        }
+    }
+
+    /** @brief Returns true if any entry in [begin, end) is active. */
+    bool AnyActive(size_t begin, size_t end) const
+    {
+        for (size_t i = begin; i < end; i = (i / 64 + 1) * 64)
+        {
+            const uint64_t bits = active[i / 64] >> (i % 64);
+            if (bits != 0)
+                return i + static_cast<size_t>(std::countr_zero(bits)) < end;
+        }
+        return false;
+    }
+};
+
+/**
+ * @brief Per-concrete-type update lists of a scene.
+ *
+ * Components are registered once (when their GameObject is mounted, or
+ * when added to an already mounted GameObject) and their interfaces are
+ * resolved at that point. Each frame the scene then walks homogeneous
+ * arrays, one per concrete component type, instead of dynamic_casting
+ * every component of every GameObject.
+ *
+ * New registrations wait in a pending-Start list. It is drained once per
+ * frame after the Update pass: Start() runs and the entry moves to its
+ * type's bucket, so it receives Update() from the next frame on.
+ * Removal is a swap-remove using the slot stored in the Component.
+ *
+ * Scripts with a lowered update frequency are skipped by the passes on the
+ * frames they are not due (see UpdateClock). Budgeted scripts are also kept
+ * in a separate list that RunBudgeted() walks round-robin within a time
+ * budget.
+ */
+class UpdateBuckets
+{
+public:
+    /** @brief Registers a component if it is IUpdateable or IParallelUpdateable. */
+    void Register(Component& component);
+
+    /** @brief Removes a component from its bucket or from the pending-Start list. */
+    void Unregister(Component& component);
+
+    /**
+     * @brief Updates a registered component's active bit.
+     * @note Called by GameObject and Component when they are enabled or disabled.
+     */
+    void SetActive(Component& component, bool active);
+
+    /**
+     * @brief Calls Update() on every active serial entry.
+     * @param context Engine context passed to the callbacks
+     * @param scheduler Receives the IParallelUpdateable buckets for this frame
+     */
+    void Update(EngineContext& context, UpdateScheduler& scheduler);
+
+    /**
+     * @brief Updates budgeted scripts, round-robin, until the budget is spent.
+     * @param context Engine context passed to the callbacks
+     * @param budgetMs Time budget; at least one script runs
+     * @note Main thread, after the parallel pass.
+     */
+    void RunBudgeted(EngineContext& context, float budgetMs);
+
+    /** @brief Adds or removes a script from the budgeted list after its frequency changed. */
+    void RefreshBudgeted(ScriptableComponent& script);
+
+    /** @brief Returns the clock of the current update pass. */
+    const UpdateClock& GetClock() const { return clock_; }
+
+    /** @brief Calls FixedUpdate() on every active entry. */
+    void FixedUpdate(EngineContext& context);
+
+    /** @brief Calls Start() on pending entries and moves them to their buckets. */
+    void RunPendingStarts(EngineContext& context);
+
+    /** @brief Drops every bucket and pending entry. */
+    void Clear();
+
+    /** @brief Returns the number of distinct updateable component types. */
+    size_t GetBucketCount() const { return buckets_.size(); }
+
+private:
+    struct Bucket
+    {
+        std::type_index type;
+        bool parallel = false;
+        UpdateList list;
+    };
+
+    void Insert(const UpdateEntry& entry);
+    void AddBudgeted(const UpdateEntry& entry);
+    void RemoveBudgeted(ScriptableComponent& script);
+
+    std::vector<Bucket> buckets_;
+    std::unordered_map<std::type_index, uint32_t> lookup_;
+    std::vector<UpdateEntry> pendingStart_;
+
+    UpdateClock clock_;
+    uint32_t nextPhase_ = 0;
+    std::vector<UpdateEntry> budgeted_;
+    size_t budgetCursor_ = 0;
+};
+
+} // namespace Axion
@@ -0,0 +1,143 @@
+#include "UpdateScheduler.hpp"
+
+#include <algorithm>
+
+namespace Axion
+{
+
+namespace
+{
+
+// Instances per job; small enough to balance, large enough to amortize the
+// submit. One word of the active mask per job.
+constexpr size_t kInstancesPerJob = 64;
+
+} // namespace
+
+void UpdateScheduler::AddSystem(std::type_index type, const UpdateList& list)
+{
+    if (!list.AnyActive(0, list.entries.size()))
+        return;
+
+    auto it = systemLookup_.find(type);
+    if (it == systemLookup_.end())
+    {
+        System system{type, {}, nullptr};
+        list.entries.front().parallel->DeclareAccess(system.access);
+        system.access.AddWrite(type);
+
+        it = systemLookup_.emplace(type, systems_.size()).first;
+        systems_.push_back(std::move(system));
+    }
+    systems_[it->second].list = &list;
+}
+
+void UpdateScheduler::Execute(EngineContext& context, const UpdateClock& clock)
+{
+    BuildBatches();
+    if (batches_.empty())
+        return;
+
+    running_.store(true, std::memory_order_release);
+    if (context.jobs)
+    {
+        for (const auto& batch : batches_)
+            RunBatch(*context.jobs, batch, context, clock);
+    }
+    else
+    {
+        RunInline(context, clock);
+    }
+    running_.store(false, std::memory_order_release);
+
+    for (auto& system : systems_)
+        system.list = nullptr;
+}
+
+void UpdateScheduler::Clear()
+{
+    systems_.clear();
+    systemLookup_.clear();
+    batches_.clear();
+}
+
+void UpdateScheduler::BuildBatches()
+{
+    batches_.clear();
+
+    // Systems are visited in registration order, so a system always lands
+    // in a later batch than every earlier system it conflicts with.
+    std::vector<size_t> level(systems_.size(), 0);
+    for (size_t j = 0; j < systems_.size(); ++j)
+    {
+        if (!systems_[j].list)
+            continue;
+
+        for (size_t i = 0; i < j; ++i)
+        {
+            if (systems_[i].list && systems_[i].access.ConflictsWith(systems_[j].access))
+                level[j] = std::max(level[j], level[i] + 1);
+        }
+
+        if (batches_.size() <= level[j])
+            batches_.resize(level[j] + 1);
+        batches_[level[j]].push_back(j);
+    }
+}
+
+void UpdateScheduler::RunBatch(JobSystem& jobs, const std::vector<size_t>& batch, EngineContext& context,
+                               const UpdateClock& clock)
+{
+    JobCounter counter;
+    EngineContext* ctx = &context;
+    const UpdateClock* frameClock = &clock;
+
+    for (size_t systemIndex : batch)
+    {
+        const System& system = systems_[systemIndex];
+        const UpdateList* list = system.list;
+        const size_t count = list->entries.size();
+        const size_t chunk = system.access.IsExclusive() ? count : kInstancesPerJob;
+
+        for (size_t begin = 0; begin < count; begin += chunk)
+        {
+            // Chunks where every component is disabled are not submitted at all
+            const size_t end = std::min(begin + chunk, count);
+            if (!list->AnyActive(begin, end))
+                continue;
+
+            jobs.Submit([list, begin, end, ctx, frameClock]
+            {
+                // Each entry belongs to one job, so Admit() may record its update
+                list->ForEachActive(begin, end,
+                                    [ctx, frameClock](const UpdateEntry& entry)
+                                    {
+                                        if (frameClock->Admit(entry))
+                                            entry.parallel->ParallelUpdate(*ctx);
+                                    });
+            }, &counter);
+        }
+    }
+
+    jobs.Wait(counter);
+}
+
+void UpdateScheduler::RunInline(EngineContext& context, const UpdateClock& clock)
+{
+    // No job system (e.g. a scene driven outside of Engine): same order, one thread
+    for (const auto& batch : batches_)
+    {
+        for (size_t systemIndex : batch)
+        {
+            const UpdateList& list = *systems_[systemIndex].list;
+            list.ForEachActive(0, list.entries.size(),
+                               [&context, &clock](const UpdateEntry& entry)
+                               {
+                                   if (clock.Admit(entry))
+                                       entry.parallel->ParallelUpdate(context);
+                               });
+        }
+    }
+}
+
+} // namespace Axion
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <atomic>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "axion_engine/core/EngineContext.hpp"
+#include "axion_engine/core/jobs/JobSystem.hpp"
+#include "axion_engine/runtime/interfaces/IParallelUpdateable.hpp"
+#include "UpdateBuckets.hpp"
+
+namespace Axion
+{
+
+/**
+ * @brief Runs IParallelUpdateable components across worker threads.
+ *
+ * Components are grouped into systems by concrete type. Every frame the
+ * scheduler builds a dependency graph between the systems that have work
+ * (an edge wherever two AccessSets conflict), levels it into batches, and
+ * runs one batch at a time: all systems of a batch, split into chunks, go
+ * to the engine's JobSystem (EngineContext::jobs) together.
+ */
+class UpdateScheduler
+{
+public:
+    /**
+     * @brief Queues a system for this frame's parallel update.
+     * @param type Concrete component type of the system
+     * @param list Update list of that type; must stay unchanged until Execute() returns
+     */
+    void AddSystem(std::type_index type, const UpdateList& list);
+
+    /**
+     * @brief Runs every queued component, then clears the queues.
+     * @param context Engine context passed to ParallelUpdate()
+     * @param clock Clock of this frame's update pass; scripts that are not due are skipped
+     */
+    void Execute(EngineContext& context, const UpdateClock& clock);
+
+    /** @brief Returns true while parallel updates are in flight. */
+    bool IsRunning() const { return running_.load(std::memory_order_acquire); }
+
+    /** @brief Drops all queued components and cached systems. */
+    void Clear();
+
+private:
+    struct System
+    {
+        std::type_index type;
+        AccessSet access;
+        const UpdateList* list = nullptr; ///< Queued for this frame, or nullptr
+    };
+
+    void BuildBatches();
+    void RunBatch(JobSystem& jobs, const std::vector<size_t>& batch, EngineContext& context, const UpdateClock& clock);
+    void RunInline(EngineContext& context, const UpdateClock& clock);
+
+    std::vector<System> systems_;
+    std::unordered_map<std::type_index, size_t> systemLookup_;
+    std::vector<std::vector<size_t>> batches_;
+
+    std::atomic<bool> running_{false};
+};
+
+} // namespace Axion
@@ -0,0 +1,50 @@
+#include "ComponentArchive.hpp"
+
+#include "SceneFormat.hpp"
+#include "axion_engine/managers/assets/AssetsManager.hpp"
+
+namespace Axion
+{
+
+uint32_t ComponentWriter::AddString(std::string_view text)
+{
+    auto it = stringIndices_.find(std::string(text));
+    if (it != stringIndices_.end())
+        return it->second;
+
+    const uint32_t index = static_cast<uint32_t>(strings_.size());
+    strings_.emplace_back(text);
+    stringIndices_.emplace(strings_.back(), index);
+    return index;
+}
+
+void ComponentWriter::WriteTexture(SDL_Texture* texture)
+{
+    if (!texture || !assets_)
+    {
+        Write(SceneFileNone);
+        return;
+    }
+
+    auto it = textureIndices_.find(texture);
+    if (it != textureIndices_.end())
+    {
+        Write(it->second);
+        return;
+    }
+
+    std::string id;
+    std::string path;
+    if (!assets_->GetTextureSource(texture, id, path))
+    {
+        Write(SceneFileNone);
+        return;
+    }
+
+    const uint32_t index = static_cast<uint32_t>(textures_.size());
+    textures_.emplace_back(AddString(id), path.empty() ? SceneFileNone : AddString(path));
+    textureIndices_.emplace(texture, index);
+    Write(index);
+}
+
+} // namespace Axion
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL.h>
+
+namespace Axion
+{
+
+class AssetsManager;
+
+/**
+ * @brief Output of Component::Serialize().
+ *
+ * Components write their settings as a flat sequence of trivially copyable
+ * values; strings and textures are stored once per file in shared tables and
+ * referenced by index. Read them back in the same order with ComponentReader.
+ *
+ * @par Usage:
+ * @code
+ * void Serialize(ComponentWriter& writer) const override
+ * {
+ *     writer.Write(speed_);
+ *     writer.WriteString(targetName_);
+ * }
+ * @endcode
+ */
+class ComponentWriter
+{
+public:
+    /** @param assets Resolves texture pointers to their ids and paths; may be null */
+    explicit ComponentWriter(const AssetsManager* assets) : assets_(assets) {}
+
+    /** @brief Appends a trivially copyable value. */
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        const size_t at = data_.size();
+        data_.resize(at + sizeof(T));
+        std::memcpy(data_.data() + at, &value, sizeof(T));
+    }
+
+    /** @brief Appends a string, stored once in the file's string table. */
+    void WriteString(std::string_view text) { Write(AddString(text)); }
+
+    /**
+     * @brief Appends a texture loaded through the AssetsManager.
+     *
+     * The file records the texture's id and path, so loading the scene
+     * loads the texture too. Textures unknown to the AssetsManager are
+     * written as null.
+     */
+    void WriteTexture(SDL_Texture* texture);
+
+    /** @brief Adds a string to the string table and returns its index. */
+    uint32_t AddString(std::string_view text);
+
+    /** @brief Returns the serialized component data. */
+    const std::vector<uint8_t>& GetData() const { return data_; }
+
+    /** @brief Returns the string table. */
+    const std::vector<std::string>& GetStrings() const { return strings_; }
+
+    /** @brief Returns the referenced textures as (id, path) string index pairs. */
+    const std::vector<std::pair<uint32_t, uint32_t>>& GetTextures() const { return textures_; }
+
+private:
+    const AssetsManager* assets_;
+
+    std::vector<uint8_t> data_;
+    std::vector<std::string> strings_;
+    std::unordered_map<std::string, uint32_t> stringIndices_;
+    std::vector<std::pair<uint32_t, uint32_t>> textures_;
+    std::unordered_map<SDL_Texture*, uint32_t> textureIndices_;
+};
+
+/**
+ * @brief Input of Component::Deserialize().
+ *
+ * Reads one component's data straight from the loaded (usually memory
+ * mapped) file. Reading past the end yields default values and sets
+ * HasFailed(), so a truncated blob never reads out of bounds.
+ */
+class ComponentReader
+{
+public:
+    ComponentReader(const uint8_t* data, size_t size,
+                    const std::vector<std::string_view>& strings,
+                    const std::vector<SDL_Texture*>& textures)
+        : data_(data), size_(size), strings_(strings), textures_(textures) {}
+
+    /** @brief Reads the next trivially copyable value. */
+    template <typename T>
+    T Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        T value{};
+        if (cursor_ + sizeof(T) > size_)
+        {
+            failed_ = true;
+            return value;
+        }
+        std::memcpy(&value, data_ + cursor_, sizeof(T));
+        cursor_ += sizeof(T);
+        return value;
+    }
+
+    /** @brief Reads the next value into @p value. */
+    template <typename T>
+    void Read(T& value) { value = Read<T>(); }
+
+    /** @brief Reads a string; the view points into the file and lives as long as the load. */
+    std::string_view ReadString()
+    {
+        const uint32_t index = Read<uint32_t>();
+        return index < strings_.size() ? strings_[index] : std::string_view();
+    }
+
+    /** @brief Reads a texture, loaded by SceneSerializer before any component. */
+    SDL_Texture* ReadTexture()
+    {
+        const uint32_t index = Read<uint32_t>();
+        return index < textures_.size() ? textures_[index] : nullptr;
+    }
+
+    /** @brief Returns true if a read went past the end of the data. */
+    bool HasFailed() const { return failed_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t cursor_ = 0;
+    bool failed_ = false;
+
+    const std::vector<std::string_view>& strings_;
+    const std::vector<SDL_Texture*>& textures_;
+};
+
+} // namespace Axion
@@ -0,0 +1,41 @@
+#include "ComponentRegistry.hpp"
+
+#include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
+#include "axion_engine/runtime/components/camera/CameraComponent.hpp"
+#include "axion_engine/runtime/components/collider/AABBColliderComponent.hpp"
+#include "axion_engine/runtime/components/collider/CircleColliderComponent.hpp"
+#include "axion_engine/runtime/components/collider/OBBColliderComponent.hpp"
+#include "axion_engine/runtime/components/renderer/CircleRenderComponent.hpp"
+#include "axion_engine/runtime/components/renderer/SpriteRenderComponent.hpp"
+#include "axion_engine/runtime/components/renderer/SquareRenderComponent.hpp"
+#include "axion_engine/runtime/components/renderer/TextRenderComponent.hpp"
+#include "axion_engine/runtime/components/rigid_body/RigidBody.hpp"
+#include "axion_engine/runtime/components/transform/TransformComponent.hpp"
+
+namespace Axion
+{
+
+ComponentRegistry::Table& ComponentRegistry::GetTable()
+{
+    static Table table;
+    static std::once_flag builtins;
+    std::call_once(builtins, [] { AddBuiltins(table); });
+    return table;
+}
+
+void ComponentRegistry::AddBuiltins(Table& table)
+{
+    // Renaming any of these breaks existing scene files
+    Add<TransformComponent>(table, "Axion.Transform");
+    Add<CameraComponent>(table, "Axion.Camera");
+    Add<SpriteRenderComponent>(table, "Axion.SpriteRender");
+    Add<SquareRenderComponent>(table, "Axion.SquareRender");
+    Add<CircleRenderComponent>(table, "Axion.CircleRender");
+    Add<TextRenderComponent>(table, "Axion.TextRender");
+    Add<AABBColliderComponent>(table, "Axion.AABBCollider");
+    Add<CircleColliderComponent>(table, "Axion.CircleCollider");
+    Add<OBBColliderComponent>(table, "Axion.OBBCollider");
+    Add<RigidBody>(table, "Axion.RigidBody");
+}
+
+} // namespace Axion
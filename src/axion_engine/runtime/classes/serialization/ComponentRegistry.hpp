@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+
+#include "axion_engine/runtime/components/Component.hpp"
+
+namespace Axion
+{
+
+/**
+ * @brief Maps component types to stable ids for scene files.
+ *
+ * A type id is a hash of the registered name, so it does not depend on
+ * registration order or on the build. Built-in components are registered
+ * automatically; register your own before saving or loading scenes that
+ * contain them. Unregistered components are skipped when saving.
+ *
+ * @par Usage:
+ * @code
+ * ComponentRegistry::Register<HealthComponent>("Game.Health");
+ * @endcode
+ *
+ * @note Thread safety: all methods lock an internal mutex.
+ */
+class ComponentRegistry
+{
+public:
+    /** @brief Placement-constructs a default component at the given address. */
+    using ConstructFn = Component* (*)(void* memory);
+
+    struct TypeInfo
+    {
+        uint32_t id = 0;
+        std::string name;
+        size_t size = 0;
+        size_t alignment = 0;
+        ConstructFn construct = nullptr;
+    };
+
+    /**
+     * @brief Registers a component type.
+     * @tparam T Default-constructible component type
+     * @param name Unique, stable name written in scene files (through its hash)
+     * @return False if another type already uses the name's id
+     */
+    template <typename T>
+    static bool Register(std::string_view name)
+    {
+        Table& table = GetTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        return Add<T>(table, name);
+    }
+
+    /**
+     * @brief Returns the registration of a type id.
+     * @return Registration, or nullptr for unknown ids
+     */
+    static const TypeInfo* Find(uint32_t id)
+    {
+        Table& table = GetTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto it = table.types.find(id);
+        return it != table.types.end() ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief Returns the registration of a component's dynamic type.
+     * @return Registration, or nullptr if the exact type is not registered
+     */
+    static const TypeInfo* Find(const Component& component)
+    {
+        Table& table = GetTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto it = table.ids.find(std::type_index(typeid(component)));
+        return it != table.ids.end() ? &table.types.at(it->second) : nullptr;
+    }
+
+    /** @brief Returns the registration of T, or nullptr. */
+    template <typename T>
+    static const TypeInfo* Find()
+    {
+        Table& table = GetTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+
+        auto it = table.ids.find(std::type_index(typeid(T)));
+        return it != table.ids.end() ? &table.types.at(it->second) : nullptr;
+    }
+
+    /** @brief Returns the type id for a name (32-bit FNV-1a). */
+    static constexpr uint32_t HashName(std::string_view name)
+    {
+        uint32_t hash = 2166136261u;
+        for (char c : name)
+        {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+private:
+    struct Table
+    {
+        std::mutex mutex;
+        std::unordered_map<uint32_t, TypeInfo> types; // Node based: TypeInfo addresses are stable
+        std::unordered_map<std::type_index, uint32_t> ids;
+    };
+
+    template <typename T>
+    static bool Add(Table& table, std::string_view name)
+    {
+        static_assert(std::is_base_of_v<Component, T>, "T must derive from Component");
+        static_assert(std::is_default_constructible_v<T>, "T must be default constructible");
+
+        const uint32_t id = HashName(name);
+        const std::type_index type(typeid(T));
+        if (table.types.count(id))
+        {
+            auto it = table.ids.find(type);
+            return it != table.ids.end() && it->second == id; // Same type registered twice is fine
+        }
+
+        TypeInfo info;
+        info.id = id;
+        info.name = std::string(name);
+        info.size = sizeof(T);
+        info.alignment = alignof(T);
+        info.construct = [](void* memory) -> Component*
+        {
+            Component* component = new (memory) T();
+            component->DetectEnableCallbacks<T>();
+            return component;
+        };
+
+        table.ids[type] = id;
+        table.types.emplace(id, std::move(info));
+        return true;
+    }
+
+    // Defined with the built-in registrations, which it adds on first use
+    static Table& GetTable();
+    static void AddBuiltins(Table& table);
+};
+
+} // namespace Axion
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Axion
+{
+
+/**
+ * @file SceneFormat.hpp
+ * @brief On-disk layout of binary scene files (.axscene).
+ *
+ * A file is a header followed by fixed-size tables and two byte regions:
+ *
+ * @code
+ * SceneFileHeader
+ * SceneFileString[stringCount]       offset/length into the string data
+ * SceneFileTexture[textureCount]     texture id + path, as string indices
+ * SceneFileObject[objectCount]       parents always precede their children
+ * SceneFileComponent[componentCount] grouped by object, transform first
+ * string data                        UTF-8, each string null-terminated
+ * component data                     packed Component::Serialize() output
+ * @endcode
+ *
+ * Tables are 4-byte aligned and only hold 32-bit fields, so a loader reads
+ * them in place from a memory-mapped file. Values are little-endian.
+ */
+
+/** @brief "AXSC" read as a little-endian 32-bit value. */
+inline constexpr uint32_t SceneFileMagic = 0x43535841u;
+
+/** @brief Bumped whenever the layout or a built-in component blob changes. */
+inline constexpr uint32_t SceneFileVersion = 1;
+
+/** @brief Index used for "no string", "no texture" and "no parent". */
+inline constexpr uint32_t SceneFileNone = 0xFFFFFFFFu;
+
+struct SceneFileHeader
+{
+    uint32_t magic = SceneFileMagic;
+    uint32_t version = SceneFileVersion;
+
+    uint32_t stringCount = 0;
+    uint32_t stringsOffset = 0;
+    uint32_t textureCount = 0;
+    uint32_t texturesOffset = 0;
+    uint32_t objectCount = 0;
+    uint32_t objectsOffset = 0;
+    uint32_t componentCount = 0;
+    uint32_t componentsOffset = 0;
+
+    uint32_t stringDataOffset = 0;
+    uint32_t stringDataSize = 0;
+    uint32_t componentDataOffset = 0;
+    uint32_t componentDataSize = 0;
+};
+
+struct SceneFileString
+{
+    uint32_t offset = 0; ///< From the start of the string data
+    uint32_t length = 0; ///< In bytes, without the terminator
+};
+
+struct SceneFileTexture
+{
+    uint32_t id = SceneFileNone;   ///< String index of the AssetsManager id
+    uint32_t path = SceneFileNone; ///< String index of the path relative to the assets folder
+};
+
+/** @brief SceneFileObject::flags bits. */
+enum SceneFileObjectFlags : uint32_t
+{
+    SceneObject_Disabled = 1u << 0
+};
+
+struct SceneFileObject
+{
+    uint32_t name = SceneFileNone;   ///< String index
+    uint32_t tag = SceneFileNone;    ///< String index
+    uint32_t parent = SceneFileNone; ///< Index of the parent object
+    uint32_t firstComponent = 0;
+    uint32_t componentCount = 0;
+    uint32_t flags = 0;
+};
+
+struct SceneFileComponent
+{
+    uint32_t type = 0;   ///< ComponentRegistry type id
+    uint32_t offset = 0; ///< From the start of the component data
+    uint32_t size = 0;   ///< In bytes
+};
+
+} // namespace Axion
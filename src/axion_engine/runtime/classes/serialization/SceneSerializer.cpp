@@ -0,0 +1,415 @@
+#include "SceneSerializer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ComponentArchive.hpp"
+#include "ComponentRegistry.hpp"
+#include "SceneFormat.hpp"
+#include "axion_engine/managers/assets/AssetsManager.hpp"
+#include "axion_engine/runtime/classes/scene/Scene.hpp"
+#include "axion_utilities/file/MappedFile.hpp"
+
+namespace Axion
+{
+
+namespace
+{
+
+bool IsLive(const GameObject* object, const std::unordered_map<const GameObject*, uint32_t>& indices)
+{
+    return object && indices.find(object) != indices.end();
+}
+
+// True if count rows of rowSize bytes at offset lie inside the file and are 4-byte aligned
+bool TableFits(uint32_t offset, uint32_t count, size_t rowSize, size_t fileSize)
+{
+    return offset % 4 == 0 &&
+           static_cast<uint64_t>(offset) + static_cast<uint64_t>(count) * rowSize <= fileSize;
+}
+
+template <typename T>
+void Append(std::ofstream& out, const std::vector<T>& rows)
+{
+    if (!rows.empty())
+        out.write(reinterpret_cast<const char*>(rows.data()), static_cast<std::streamsize>(rows.size() * sizeof(T)));
+}
+
+} // namespace
+
+bool SceneSerializer::Save(const Scene& scene, const std::string& path)
+{
+    // Live objects, each parent before its children, so the loader can
+    // parent objects as it creates them
+    std::vector<const GameObject*> candidates;
+    candidates.reserve(scene.objects_.size() + scene.spawnQueue_.size());
+    for (const auto& object : scene.objects_)
+    {
+        if (object && !object->isDestroyed_)
+            candidates.push_back(object.get());
+    }
+    for (const auto& object : scene.spawnQueue_)
+    {
+        if (object && !object->isDestroyed_)
+            candidates.push_back(object.get());
+    }
+
+    std::unordered_map<const GameObject*, uint32_t> indices;
+    for (const GameObject* object : candidates)
+        indices.emplace(object, 0);
+
+    std::vector<const GameObject*> order;
+    order.reserve(candidates.size());
+    std::vector<const GameObject*> stack;
+    for (const GameObject* root : candidates)
+    {
+        if (IsLive(root->GetParent(), indices))
+            continue;
+
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            const GameObject* object = stack.back();
+            stack.pop_back();
+            indices[object] = static_cast<uint32_t>(order.size());
+            order.push_back(object);
+
+            const auto& children = object->GetChildren();
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                if (IsLive(*it, indices))
+                    stack.push_back(*it);
+            }
+        }
+    }
+
+    ComponentWriter writer(ctx_.assets);
+    std::vector<SceneFileObject> objects;
+    std::vector<SceneFileComponent> components;
+    objects.reserve(order.size());
+    size_t skipped = 0;
+
+    auto writeComponent = [&writer, &components](const Component& component)
+    {
+        const ComponentRegistry::TypeInfo* type = ComponentRegistry::Find(component);
+        if (!type)
+            return false;
+
+        SceneFileComponent record;
+        record.type = type->id;
+        record.offset = static_cast<uint32_t>(writer.GetData().size());
+        component.Serialize(writer);
+        record.size = static_cast<uint32_t>(writer.GetData().size() - record.offset);
+        components.push_back(record);
+        return true;
+    };
+
+    for (const GameObject* object : order)
+    {
+        SceneFileObject record;
+        if (object->nameId_ != InvalidNameId)
+            record.name = writer.AddString(NameRegistry::GetString(object->nameId_));
+        if (object->tagId_ != InvalidNameId)
+            record.tag = writer.AddString(NameRegistry::GetString(object->tagId_));
+        if (IsLive(object->GetParent(), indices))
+            record.parent = indices[object->GetParent()];
+        record.flags = object->isEnabled_ ? 0u : static_cast<uint32_t>(SceneObject_Disabled);
+        record.firstComponent = static_cast<uint32_t>(components.size());
+
+        // The loader relies on the transform coming first
+        writeComponent(*object->transform_);
+        for (const auto& component : object->GetAllComponents())
+        {
+            if (component.get() != object->transform_ && !writeComponent(*component))
+                ++skipped;
+        }
+
+        record.componentCount = static_cast<uint32_t>(components.size()) - record.firstComponent;
+        objects.push_back(record);
+    }
+
+    // Tables
+    std::vector<SceneFileString> strings;
+    std::string stringData;
+    strings.reserve(writer.GetStrings().size());
+    for (const std::string& text : writer.GetStrings())
+    {
+        strings.push_back({static_cast<uint32_t>(stringData.size()), static_cast<uint32_t>(text.size())});
+        stringData += text;
+        stringData.push_back('\0');
+    }
+    stringData.resize((stringData.size() + 3) / 4 * 4, '\0'); // Keeps the component data aligned
+
+    std::vector<SceneFileTexture> textures;
+    textures.reserve(writer.GetTextures().size());
+    for (const auto& [id, texturePath] : writer.GetTextures())
+        textures.push_back({id, texturePath});
+
+    SceneFileHeader header;
+    uint64_t offset = sizeof(SceneFileHeader);
+    auto place = [&offset](uint32_t& field, uint64_t bytes)
+    {
+        field = static_cast<uint32_t>(offset);
+        offset += bytes;
+    };
+    header.stringCount = static_cast<uint32_t>(strings.size());
+    place(header.stringsOffset, strings.size() * sizeof(SceneFileString));
+    header.textureCount = static_cast<uint32_t>(textures.size());
+    place(header.texturesOffset, textures.size() * sizeof(SceneFileTexture));
+    header.objectCount = static_cast<uint32_t>(objects.size());
+    place(header.objectsOffset, objects.size() * sizeof(SceneFileObject));
+    header.componentCount = static_cast<uint32_t>(components.size());
+    place(header.componentsOffset, components.size() * sizeof(SceneFileComponent));
+    header.stringDataSize = static_cast<uint32_t>(stringData.size());
+    place(header.stringDataOffset, stringData.size());
+    header.componentDataSize = static_cast<uint32_t>(writer.GetData().size());
+    place(header.componentDataOffset, writer.GetData().size());
+
+    if (offset > std::numeric_limits<uint32_t>::max())
+    {
+        ERROR("Scene too large to save to '{}'", path.c_str());
+        return false;
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+    {
+        ERROR("Cannot write scene file '{}'", path.c_str());
+        return false;
+    }
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    Append(out, strings);
+    Append(out, textures);
+    Append(out, objects);
+    Append(out, components);
+    out.write(stringData.data(), static_cast<std::streamsize>(stringData.size()));
+    Append(out, writer.GetData());
+
+    if (!out)
+    {
+        ERROR("Failed writing scene file '{}'", path.c_str());
+        return false;
+    }
+
+    if (skipped > 0)
+        WARN("{} unregistered components were not saved to '{}'", skipped, path.c_str());
+    INFO("Saved {} objects to '{}'", objects.size(), path.c_str());
+    return true;
+}
+
+std::vector<GameObject*> SceneSerializer::Load(Scene& scene, const std::string& path)
+{
+    std::vector<GameObject*> result;
+
+    MappedFile file;
+    if (!file.Open(path))
+    {
+        ERROR("Cannot open scene file '{}'", path.c_str());
+        return result;
+    }
+
+    const uint8_t* data = file.GetData();
+    const size_t size = file.GetSize();
+
+    SceneFileHeader header;
+    if (size < sizeof(header))
+    {
+        ERROR("Invalid scene file '{}'", path.c_str());
+        return result;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (header.magic != SceneFileMagic || header.version != SceneFileVersion)
+    {
+        ERROR("Unsupported scene file '{}' (version {})", path.c_str(), header.version);
+        return result;
+    }
+
+    if (!TableFits(header.stringsOffset, header.stringCount, sizeof(SceneFileString), size) ||
+        !TableFits(header.texturesOffset, header.textureCount, sizeof(SceneFileTexture), size) ||
+        !TableFits(header.objectsOffset, header.objectCount, sizeof(SceneFileObject), size) ||
+        !TableFits(header.componentsOffset, header.componentCount, sizeof(SceneFileComponent), size) ||
+        !TableFits(header.stringDataOffset, header.stringDataSize, 1, size) ||
+        !TableFits(header.componentDataOffset, header.componentDataSize, 1, size))
+    {
+        ERROR("Corrupted scene file '{}'", path.c_str());
+        return result;
+    }
+
+    // Tables are read in place from the mapping
+    const auto* fileStrings = reinterpret_cast<const SceneFileString*>(data + header.stringsOffset);
+    const auto* fileTextures = reinterpret_cast<const SceneFileTexture*>(data + header.texturesOffset);
+    const auto* fileObjects = reinterpret_cast<const SceneFileObject*>(data + header.objectsOffset);
+    const auto* fileComponents = reinterpret_cast<const SceneFileComponent*>(data + header.componentsOffset);
+    const auto* stringData = reinterpret_cast<const char*>(data + header.stringDataOffset);
+    const uint8_t* componentData = data + header.componentDataOffset;
+
+    std::vector<std::string_view> strings(header.stringCount);
+    for (uint32_t i = 0; i < header.stringCount; ++i)
+    {
+        const SceneFileString& entry = fileStrings[i];
+        if (static_cast<uint64_t>(entry.offset) + entry.length > header.stringDataSize)
+        {
+            ERROR("Corrupted scene file '{}'", path.c_str());
+            return result;
+        }
+        strings[i] = std::string_view(stringData + entry.offset, entry.length);
+    }
+    auto stringAt = [&strings](uint32_t index)
+    {
+        return index < strings.size() ? strings[index] : std::string_view();
+    };
+
+    // Validate the object and component tables before creating anything
+    const ComponentRegistry::TypeInfo* transformType = ComponentRegistry::Find<TransformComponent>();
+    std::vector<const ComponentRegistry::TypeInfo*> types(header.componentCount, nullptr);
+    std::vector<size_t> offsets(header.componentCount, 0);
+    std::unordered_set<uint32_t> unknownTypes;
+    size_t blockSize = 0;
+    size_t blockAlignment = alignof(std::max_align_t);
+    uint32_t nextComponent = 0;
+
+    for (uint32_t i = 0; i < header.objectCount; ++i)
+    {
+        const SceneFileObject& object = fileObjects[i];
+        const bool valid = (object.parent == SceneFileNone || object.parent < i) &&
+                           object.firstComponent == nextComponent &&
+                           object.componentCount > 0 &&
+                           static_cast<uint64_t>(object.firstComponent) + object.componentCount <= header.componentCount &&
+                           fileComponents[object.firstComponent].type == transformType->id;
+        if (!valid)
+        {
+            ERROR("Corrupted scene file '{}'", path.c_str());
+            return result;
+        }
+        nextComponent += object.componentCount;
+    }
+
+    for (uint32_t i = 0; i < header.componentCount; ++i)
+    {
+        const SceneFileComponent& component = fileComponents[i];
+        if (static_cast<uint64_t>(component.offset) + component.size > header.componentDataSize)
+        {
+            ERROR("Corrupted scene file '{}'", path.c_str());
+            return result;
+        }
+
+        types[i] = ComponentRegistry::Find(component.type);
+        if (!types[i])
+        {
+            unknownTypes.insert(component.type);
+            continue;
+        }
+
+        blockSize = (blockSize + types[i]->alignment - 1) / types[i]->alignment * types[i]->alignment;
+        offsets[i] = blockSize;
+        blockSize += types[i]->size;
+        blockAlignment = std::max(blockAlignment, types[i]->alignment);
+    }
+
+    if (nextComponent != header.componentCount)
+    {
+        ERROR("Corrupted scene file '{}'", path.c_str());
+        return result;
+    }
+    if (!unknownTypes.empty())
+        WARN("Skipped components of {} unregistered types in '{}'", unknownTypes.size(), path.c_str());
+    if (header.objectCount == 0)
+        return result;
+
+    // Textures: cached ones are reused, missing ones decoded in parallel
+    std::vector<SDL_Texture*> textures(header.textureCount, nullptr);
+    if (ctx_.assets)
+    {
+        std::vector<uint32_t> missing;
+        for (uint32_t i = 0; i < header.textureCount; ++i)
+        {
+            textures[i] = assets().GetTexture(std::string(stringAt(fileTextures[i].id)));
+            if (!textures[i] && !stringAt(fileTextures[i].path).empty())
+                missing.push_back(i);
+        }
+
+        std::vector<SDL_Surface*> surfaces(missing.size(), nullptr);
+        auto decode = [&](size_t begin, size_t end)
+        {
+            for (size_t k = begin; k < end; ++k)
+                surfaces[k] = assets().DecodeSurface(std::string(stringAt(fileTextures[missing[k]].path)));
+        };
+        if (ctx_.jobs)
+            jobs().ParallelFor(missing.size(), 1, decode);
+        else
+            decode(0, missing.size());
+
+        for (size_t k = 0; k < missing.size(); ++k)
+        {
+            const SceneFileTexture& texture = fileTextures[missing[k]];
+            textures[missing[k]] = assets().CreateTexture(std::string(stringAt(texture.id)), surfaces[k],
+                                                          std::string(stringAt(texture.path)));
+        }
+    }
+
+    // One allocation holds the components of the whole file
+    auto* block = new ComponentBlock();
+    block->alignment = std::align_val_t(blockAlignment);
+    block->memory = ::operator new(blockSize, block->alignment);
+    auto* base = static_cast<std::byte*>(block->memory);
+
+    std::vector<std::unique_ptr<GameObject>> created;
+    created.reserve(header.objectCount);
+    result.reserve(header.objectCount);
+    size_t truncated = 0;
+
+    for (uint32_t i = 0; i < header.objectCount; ++i)
+    {
+        const SceneFileObject& record = fileObjects[i];
+
+        std::unique_ptr<GameObject> object(new GameObject(scene, GameObject::NoTransformTag{}));
+        object->components_.reserve(record.componentCount);
+        object->nameId_ = NameRegistry::Intern(stringAt(record.name));
+        object->tagId_ = NameRegistry::Intern(stringAt(record.tag));
+        object->isEnabled_ = (record.flags & SceneObject_Disabled) == 0;
+
+        // The first component is the transform (validated above)
+        for (uint32_t c = record.firstComponent; c < record.firstComponent + record.componentCount; ++c)
+        {
+            if (!types[c])
+                continue;
+
+            Component* component = types[c]->construct(base + offsets[c]);
+            ++block->liveCount;
+
+            ComponentReader reader(componentData + fileComponents[c].offset, fileComponents[c].size, strings, textures);
+            component->Deserialize(reader);
+            if (reader.HasFailed())
+                ++truncated;
+
+            object->AdoptComponent(ComponentPtr(component, ComponentDeleter{block}));
+        }
+
+        if (record.parent != SceneFileNone)
+            object->SetParent(result[record.parent]);
+
+        result.push_back(object.get());
+        created.push_back(std::move(object));
+    }
+
+    if (truncated > 0)
+        WARN("{} components of '{}' had truncated data", truncated, path.c_str());
+
+    {
+        std::lock_guard<std::mutex> lock(scene.structureMutex_);
+        scene.spawnQueue_.insert(scene.spawnQueue_.end(),
+                                 std::make_move_iterator(created.begin()),
+                                 std::make_move_iterator(created.end()));
+    }
+
+    INFO("Loaded {} objects from '{}'", result.size(), path.c_str());
+    return result;
+}
+
+} // namespace Axion
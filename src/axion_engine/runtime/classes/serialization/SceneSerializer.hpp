@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "axion_engine/structure/ContextAware.hpp"
+
+namespace Axion
+{
+
+class GameObject;
+class Scene;
+
+/**
+ * @brief Writes scenes to, and loads them from, binary scene files.
+ *
+ * Saving records every live GameObject with its name, tag, parent, enabled
+ * state and registered components (see ComponentRegistry and
+ * Component::Serialize()). Scripts and other unregistered components are
+ * skipped; add them after loading, or register them.
+ *
+ * Loading memory-maps the file and builds the objects straight from it:
+ * missing textures are decoded on the JobSystem, the components of the
+ * whole file share a single allocation, and strings are read in place.
+ * The file layout is described in SceneFormat.hpp.
+ *
+ * @par Usage:
+ * @code
+ * // Authoring tool or debug key
+ * scene->SaveToFile(GetPath("levels") + "level1.axscene");
+ *
+ * // In OnSceneEnter()
+ * LoadFromFile(GetPath("levels") + "level1.axscene");
+ * @endcode
+ */
+class SceneSerializer : public ContextAware
+{
+public:
+    using ContextAware::ContextAware;
+
+    /**
+     * @brief Writes the live objects of a scene to a file.
+     * @param scene Scene to save
+     * @param path Destination file, overwritten
+     * @return False if the file could not be written
+     */
+    bool Save(const Scene& scene, const std::string& path);
+
+    /**
+     * @brief Adds the objects of a scene file to a scene.
+     * @param scene Scene receiving the objects, mounted with its next spawn batch
+     * @param path Scene file written by Save()
+     * @return The loaded objects, parents before children; empty if the file is missing or invalid
+     */
+    std::vector<GameObject*> Load(Scene& scene, const std::string& path);
+};
+
+} // namespace Axion
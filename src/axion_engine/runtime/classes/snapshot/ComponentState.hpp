@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Axion
+{
+
+/**
+ * @brief Output of Component::SaveState().
+ *
+ * Appends raw values to the snapshot arena. Unlike ComponentWriter there is
+ * no string or texture table: snapshots never leave the process, so
+ * pointers and handles may be stored as they are.
+ */
+class StateWriter
+{
+public:
+    explicit StateWriter(std::vector<uint8_t>& data) : data_(data) {}
+
+    /** @brief Appends a trivially copyable value. */
+    template <typename T>
+    void Write(const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        const size_t at = data_.size();
+        data_.resize(at + sizeof(T));
+        std::memcpy(data_.data() + at, &value, sizeof(T));
+    }
+
+private:
+    std::vector<uint8_t>& data_;
+};
+
+/**
+ * @brief Input of Component::LoadState().
+ *
+ * Reading past the component's state yields default values and sets
+ * HasFailed().
+ */
+class StateReader
+{
+public:
+    StateReader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+    /** @brief Reads the next trivially copyable value. */
+    template <typename T>
+    T Read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+        T value{};
+        if (cursor_ + sizeof(T) > size_)
+        {
+            failed_ = true;
+            return value;
+        }
+        std::memcpy(&value, data_ + cursor_, sizeof(T));
+        cursor_ += sizeof(T);
+        return value;
+    }
+
+    /** @brief Reads the next value into @p value. */
+    template <typename T>
+    void Read(T& value) { value = Read<T>(); }
+
+    /** @brief Returns true if a read went past the end of the state. */
+    bool HasFailed() const { return failed_; }
+
+private:
+    const uint8_t* data_;
+    size_t size_;
+    size_t cursor_ = 0;
+    bool failed_ = false;
+};
+
+} // namespace Axion
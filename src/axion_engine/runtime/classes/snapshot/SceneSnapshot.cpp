@@ -0,0 +1,147 @@
+#include "SceneSnapshot.hpp"
+
+#include <cstring>
+#include <unordered_map>
+
+#include "ComponentState.hpp"
+#include "axion_engine/runtime/classes/scene/Scene.hpp"
+#include "axion_engine/runtime/classes/serialization/ComponentRegistry.hpp"
+
+namespace Axion
+{
+
+namespace
+{
+
+// Registered type id of a component, 0 if its type is not registered
+uint32_t GetTypeId(const Component& component)
+{
+    const ComponentRegistry::TypeInfo* type = ComponentRegistry::Find(component);
+    return type ? type->id : 0;
+}
+
+} // namespace
+
+void SceneSnapshot::Capture(const Scene& scene)
+{
+    data_.clear();
+    objectCount_ = 0;
+
+    StateWriter writer(data_);
+    for (size_t i = 0; i < scene.objects_.size(); ++i)
+    {
+        const GameObject* object = scene.objects_[i].get();
+        if (!object || object->isDestroyed_)
+            continue;
+
+        const size_t headerAt = data_.size();
+        data_.resize(headerAt + sizeof(ObjectHeader));
+
+        // Each state is prefixed with its type id, so it is never loaded into
+        // another type, and with its size, so a component can never read
+        // into the next one's state
+        for (const auto& component : object->components_)
+        {
+            const uint32_t typeId = GetTypeId(*component);
+            const size_t typeAt = data_.size();
+            data_.resize(typeAt + sizeof(uint32_t) * 2);
+            std::memcpy(data_.data() + typeAt, &typeId, sizeof(typeId));
+
+            const size_t sizeAt = typeAt + sizeof(uint32_t);
+            component->SaveState(writer);
+
+            const auto size = static_cast<uint32_t>(data_.size() - sizeAt - sizeof(uint32_t));
+            std::memcpy(data_.data() + sizeAt, &size, sizeof(size));
+        }
+
+        ObjectHeader header;
+        header.id = object->id_;
+        header.index = static_cast<uint32_t>(i);
+        header.componentCount = static_cast<uint32_t>(object->components_.size());
+        header.enabled = object->isEnabled_ ? 1u : 0u;
+        header.stateSize = static_cast<uint32_t>(data_.size() - headerAt - sizeof(ObjectHeader));
+        std::memcpy(data_.data() + headerAt, &header, sizeof(header));
+        ++objectCount_;
+    }
+}
+
+size_t SceneSnapshot::Restore(Scene& scene) const
+{
+    // Objects are looked up at their captured position first; the id map is
+    // only built once that fails (objects were spawned or destroyed since)
+    std::unordered_map<size_t, GameObject*> byId;
+    auto find = [&scene, &byId](const ObjectHeader& header) -> GameObject*
+    {
+        if (header.index < scene.objects_.size())
+        {
+            GameObject* object = scene.objects_[header.index].get();
+            if (object && object->id_ == header.id)
+                return object;
+        }
+
+        if (byId.empty())
+        {
+            for (const auto& object : scene.objects_)
+            {
+                if (object)
+                    byId.emplace(object->id_, object.get());
+            }
+        }
+        auto it = byId.find(header.id);
+        return it != byId.end() ? it->second : nullptr;
+    };
+
+    size_t restored = 0;
+    size_t at = 0;
+    while (at + sizeof(ObjectHeader) <= data_.size())
+    {
+        ObjectHeader header;
+        std::memcpy(&header, data_.data() + at, sizeof(header));
+        at += sizeof(header);
+
+        const size_t end = at + header.stateSize;
+        if (end > data_.size())
+            break;
+
+        GameObject* object = find(header);
+        bool matches = object && !object->isDestroyed_ && object->components_.size() == header.componentCount;
+
+        // Components replaced by another type since the capture skip the whole object
+        for (size_t cursor = at, i = 0; matches && i < header.componentCount; ++i)
+        {
+            uint32_t typeId = 0;
+            uint32_t size = 0;
+            std::memcpy(&typeId, data_.data() + cursor, sizeof(typeId));
+            std::memcpy(&size, data_.data() + cursor + sizeof(typeId), sizeof(size));
+            matches = typeId == GetTypeId(*object->components_[i]);
+            cursor += sizeof(typeId) + sizeof(size) + size;
+        }
+
+        if (matches)
+        {
+            size_t cursor = at;
+            for (const auto& component : object->components_)
+            {
+                uint32_t size = 0;
+                cursor += sizeof(uint32_t); // Type id, checked above
+                std::memcpy(&size, data_.data() + cursor, sizeof(size));
+                cursor += sizeof(size);
+
+                StateReader reader(data_.data() + cursor, size);
+                component->LoadState(reader);
+                cursor += size;
+            }
+
+            if (header.enabled)
+                object->Enable();
+            else
+                object->Disable();
+            ++restored;
+        }
+
+        at = end;
+    }
+    return restored;
+}
+
+} // namespace Axion
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Axion
+{
+
+class Scene;
+
+/**
+ * @brief State of a scene's objects at one point in time.
+ *
+ * A flat buffer holding, for every live GameObject, its id, enabled state
+ * and the Component::SaveState() output of each component. The buffer keeps
+ * its capacity, so capturing into the same snapshot every frame does not
+ * allocate once it has grown.
+ *
+ * Restoring writes the state back into the objects that still exist,
+ * matched by id; no GameObject is created or destroyed. Objects spawned
+ * after the capture keep their state, and objects whose component list
+ * changed since (count or registered types, see ComponentRegistry) are
+ * skipped.
+ *
+ * @par Usage:
+ * @code
+ * SceneSnapshot checkpoint;
+ * scene->CaptureSnapshot(checkpoint);
+ * // ...
+ * scene->RestoreSnapshot(checkpoint);
+ * @endcode
+ *
+ * @see SnapshotHistory for keeping many snapshots with delta compression.
+ */
+class SceneSnapshot
+{
+public:
+    /** @brief Returns the captured state. */
+    const std::vector<uint8_t>& GetData() const { return data_; }
+
+    /** @brief Returns the size of the captured state in bytes. */
+    size_t GetSize() const { return data_.size(); }
+
+    /** @brief Returns the number of captured objects. */
+    size_t GetObjectCount() const { return objectCount_; }
+
+    /** @brief Returns true if nothing was captured. */
+    bool IsEmpty() const { return data_.empty(); }
+
+private:
+    friend class Scene;
+    friend class SnapshotHistory;
+
+    // Precedes each object's component states
+    struct ObjectHeader
+    {
+        uint64_t id;
+        uint32_t index;          ///< Position in the scene's object list, tried first on restore
+        uint32_t componentCount;
+        uint32_t enabled;
+        uint32_t stateSize;      ///< Bytes of component states that follow, each as type id, size and state
+    };
+
+    void Capture(const Scene& scene);
+    size_t Restore(Scene& scene) const;
+
+    std::vector<uint8_t> data_;
+    size_t objectCount_ = 0;
+};
+
+} // namespace Axion
@@ -0,0 +1,203 @@
+#include "SnapshotHistory.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "axion_engine/runtime/classes/scene/Scene.hpp"
+
+namespace Axion
+{
+
+namespace
+{
+
+// Encoded deltas are a sequence of tokens:
+//   uint32 unchanged bytes, uint32 changed bytes, then the changed bytes XOR the base.
+// Bytes past the last token are unchanged.
+constexpr size_t kMinZeroRun = 8; // Shorter unchanged gaps stay inside a literal
+
+const std::vector<uint8_t> kNoBase;
+
+void EncodeDelta(const std::vector<uint8_t>& base, const std::vector<uint8_t>& raw, std::vector<uint8_t>& out)
+{
+    out.clear();
+    const size_t size = raw.size();
+    const size_t shared = std::min(size, base.size());
+    auto changed = [&](size_t i) { return raw[i] != (i < base.size() ? base[i] : 0); };
+
+    size_t i = 0;
+    while (i < size)
+    {
+        // Unchanged run, a word at a time while the base covers it
+        const size_t runStart = i;
+        while (i + 8 <= shared && std::memcmp(raw.data() + i, base.data() + i, 8) == 0)
+            i += 8;
+        while (i < size && !changed(i))
+            ++i;
+        if (i == size)
+            break;
+
+        // Changed run, until kMinZeroRun unchanged bytes in a row
+        const size_t literalStart = i;
+        size_t literalEnd = i;
+        for (size_t j = i; j < size && j - literalEnd < kMinZeroRun; ++j)
+        {
+            if (changed(j))
+                literalEnd = j + 1;
+        }
+
+        const auto zeros = static_cast<uint32_t>(literalStart - runStart);
+        const auto length = static_cast<uint32_t>(literalEnd - literalStart);
+        const size_t at = out.size();
+        out.resize(at + 2 * sizeof(uint32_t) + length);
+        std::memcpy(out.data() + at, &zeros, sizeof(zeros));
+        std::memcpy(out.data() + at + sizeof(zeros), &length, sizeof(length));
+        uint8_t* literal = out.data() + at + 2 * sizeof(uint32_t);
+        for (size_t k = 0; k < length; ++k)
+        {
+            const size_t index = literalStart + k;
+            literal[k] = raw[index] ^ (index < base.size() ? base[index] : 0);
+        }
+
+        i = literalEnd;
+    }
+}
+
+void DecodeDelta(const std::vector<uint8_t>& base, const std::vector<uint8_t>& encoded, size_t rawSize,
+                 std::vector<uint8_t>& out)
+{
+    out.assign(rawSize, 0);
+    std::memcpy(out.data(), base.data(), std::min(base.size(), rawSize));
+
+    size_t position = 0;
+    size_t at = 0;
+    while (at + 2 * sizeof(uint32_t) <= encoded.size())
+    {
+        uint32_t zeros = 0;
+        uint32_t length = 0;
+        std::memcpy(&zeros, encoded.data() + at, sizeof(zeros));
+        std::memcpy(&length, encoded.data() + at + sizeof(zeros), sizeof(length));
+        at += 2 * sizeof(uint32_t);
+
+        position += zeros;
+        for (uint32_t k = 0; k < length; ++k)
+            out[position + k] ^= encoded[at + k];
+        position += length;
+        at += length;
+    }
+}
+
+} // namespace
+
+SnapshotHistory::SnapshotHistory(size_t capacity, size_t keyframeInterval)
+    : slots_(std::max<size_t>(capacity, 1)),
+      keyframeInterval_(std::clamp<size_t>(keyframeInterval, 1, std::max<size_t>(slots_.size() / 2, 1)))
+{
+}
+
+uint64_t SnapshotHistory::Capture(const Scene& scene)
+{
+    scene.CaptureSnapshot(capture_);
+    return Record(capture_);
+}
+
+uint64_t SnapshotHistory::Record(const SceneSnapshot& snapshot)
+{
+    if (count_ == slots_.size())
+        DropOldestGroup();
+
+    const bool keyframe = count_ == 0 || sinceKeyframe_ >= keyframeInterval_;
+
+    Slot& slot = slots_[(head_ + count_) % slots_.size()];
+    EncodeDelta(keyframe ? kNoBase : previous_, snapshot.data_, slot.encoded);
+    slot.rawSize = snapshot.data_.size();
+    slot.objectCount = snapshot.objectCount_;
+    slot.keyframe = keyframe;
+
+    sinceKeyframe_ = keyframe ? 1 : sinceKeyframe_ + 1;
+    previous_ = snapshot.data_;
+    ++count_;
+    return nextSequence_++;
+}
+
+bool SnapshotHistory::Get(uint64_t sequence, SceneSnapshot& out) const
+{
+    if (count_ == 0 || sequence < GetOldest() || sequence > GetNewest())
+        return false;
+
+    // The oldest snapshot is always a keyframe
+    uint64_t first = sequence;
+    while (!slots_[SlotIndex(first)].keyframe)
+        --first;
+
+    const Slot& keyframe = slots_[SlotIndex(first)];
+    DecodeDelta(kNoBase, keyframe.encoded, keyframe.rawSize, out.data_);
+    for (uint64_t s = first + 1; s <= sequence; ++s)
+    {
+        const Slot& delta = slots_[SlotIndex(s)];
+        DecodeDelta(out.data_, delta.encoded, delta.rawSize, work_);
+        std::swap(out.data_, work_);
+    }
+    out.objectCount_ = slots_[SlotIndex(sequence)].objectCount;
+    return true;
+}
+
+bool SnapshotHistory::Restore(Scene& scene, uint64_t sequence)
+{
+    if (!Get(sequence, capture_))
+        return false;
+
+    scene.RestoreSnapshot(capture_);
+    return true;
+}
+
+void SnapshotHistory::DiscardAfter(uint64_t sequence)
+{
+    if (count_ == 0 || sequence >= GetNewest())
+        return;
+    if (sequence < GetOldest())
+    {
+        Clear();
+        return;
+    }
+
+    count_ = static_cast<size_t>(sequence - GetOldest() + 1);
+    nextSequence_ = sequence + 1;
+
+    // The next delta is taken against the new newest snapshot
+    Get(sequence, capture_);
+    previous_ = capture_.data_;
+
+    uint64_t keyframe = sequence;
+    while (!slots_[SlotIndex(keyframe)].keyframe)
+        --keyframe;
+    sinceKeyframe_ = static_cast<size_t>(sequence - keyframe + 1);
+}
+
+void SnapshotHistory::Clear()
+{
+    head_ = 0;
+    count_ = 0;
+    sinceKeyframe_ = 0;
+    previous_.clear();
+}
+
+size_t SnapshotHistory::GetMemoryUsage() const
+{
+    size_t bytes = 0;
+    for (size_t i = 0; i < count_; ++i)
+        bytes += slots_[(head_ + i) % slots_.size()].encoded.size();
+    return bytes;
+}
+
+void SnapshotHistory::DropOldestGroup()
+{
+    // Deltas cannot outlive their keyframe
+    do
+    {
+        head_ = (head_ + 1) % slots_.size();
+        --count_;
+    } while (count_ > 0 && !slots_[head_].keyframe);
+}
+
+} // namespace Axion
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "SceneSnapshot.hpp"
+
+namespace Axion
+{
+
+class Scene;
+
+/**
+ * @brief Ring buffer of scene snapshots with delta compression.
+ *
+ * Each recorded snapshot is stored as the XOR of its state with the
+ * previous snapshot's, run-length encoded: state that did not change
+ * between two captures (static objects, resting bodies) costs almost
+ * nothing. Every keyframeInterval snapshots a full keyframe is stored, so
+ * rebuilding one snapshot decodes at most that many deltas.
+ *
+ * When full, the oldest keyframe and the deltas that depend on it are
+ * dropped together. Slots keep their buffers, so recording every frame
+ * stops allocating once the history has filled up.
+ *
+ * @par Usage (rewind):
+ * @code
+ * // Every fixed step
+ * history.Capture(*scene);
+ *
+ * // Rewind one step per frame while the key is held
+ * if (history.GetCount() > 1)
+ * {
+ *     history.DiscardAfter(history.GetNewest() - 1);
+ *     history.Restore(*scene, history.GetNewest());
+ * }
+ * @endcode
+ */
+class SnapshotHistory
+{
+public:
+    /**
+     * @param capacity Maximum number of snapshots kept
+     * @param keyframeInterval Snapshots between two full keyframes, clamped to half the
+     *        capacity so dropping the oldest group never empties the history
+     */
+    explicit SnapshotHistory(size_t capacity = 120, size_t keyframeInterval = 30);
+
+    /**
+     * @brief Captures a scene and records the snapshot.
+     * @return Sequence number of the new snapshot
+     */
+    uint64_t Capture(const Scene& scene);
+
+    /**
+     * @brief Records a snapshot captured with Scene::CaptureSnapshot().
+     * @return Sequence number of the new snapshot
+     */
+    uint64_t Record(const SceneSnapshot& snapshot);
+
+    /**
+     * @brief Rebuilds a recorded snapshot.
+     * @param sequence Sequence number returned by Capture() or Record()
+     * @param out Receives the snapshot
+     * @return False if the snapshot is no longer (or not yet) in the history
+     */
+    bool Get(uint64_t sequence, SceneSnapshot& out) const;
+
+    /**
+     * @brief Restores a scene to a recorded snapshot.
+     * @return False if the snapshot is not in the history
+     * @note Newer snapshots are kept; call DiscardAfter() before recording
+     *       a new timeline from the restored state.
+     */
+    bool Restore(Scene& scene, uint64_t sequence);
+
+    /** @brief Drops every snapshot newer than @p sequence. */
+    void DiscardAfter(uint64_t sequence);
+
+    /** @brief Drops every snapshot. */
+    void Clear();
+
+    /** @brief Returns the number of snapshots kept. */
+    size_t GetCount() const { return count_; }
+
+    /** @brief Returns the sequence number of the oldest snapshot kept. */
+    uint64_t GetOldest() const { return nextSequence_ - count_; }
+
+    /** @brief Returns the sequence number of the newest snapshot (only valid if GetCount() > 0). */
+    uint64_t GetNewest() const { return nextSequence_ - 1; }
+
+    /** @brief Returns the bytes used by the encoded snapshots. */
+    size_t GetMemoryUsage() const;
+
+private:
+    struct Slot
+    {
+        std::vector<uint8_t> encoded;
+        size_t rawSize = 0;
+        size_t objectCount = 0;
+        bool keyframe = false;
+    };
+
+    size_t SlotIndex(uint64_t sequence) const { return (head_ + (sequence - GetOldest())) % slots_.size(); }
+    void DropOldestGroup();
+
+    std::vector<Slot> slots_;
+    size_t head_ = 0;  // Slot of the oldest snapshot
+    size_t count_ = 0;
+    uint64_t nextSequence_ = 0;
+
+    size_t keyframeInterval_;
+    size_t sinceKeyframe_ = 0;
+
+    std::vector<uint8_t> previous_;     // Raw state of the newest snapshot, base of the next delta
+    SceneSnapshot capture_;             // Scratch for Capture()
+    mutable std::vector<uint8_t> work_; // Scratch for Get()
+};
+
+} // namespace Axion
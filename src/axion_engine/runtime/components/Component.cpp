@@ -1,6 +1,46 @@
 #include "Component.hpp"
 
+#include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
+
 namespace Axion
 {
 
+void Component::SetEnabled(bool enabled)
+{
+    if (enabled_ == enabled)
+        return;
+    enabled_ = enabled;
+
+    // While the GameObject is disabled only the flag changes
+    if (owner_ && owner_->IsEnabled())
+        owner_->OnComponentToggled(*this);
+}
+
+void Component::MarkRenderDirty()
+{
+    if (owner_ && renderSlot_ != UINT32_MAX)
+        owner_->OnRenderableChanged(*this);
+}
+
+bool Component::IsActive() const
+{
+    return enabled_ && owner_ && owner_->IsEnabled() && !owner_->IsDestroyed();
+}
+
+void ComponentDeleter::operator()(Component* component) const
+{
+    if (!block)
+    {
+        delete component;
+        return;
+    }
+
+    component->~Component();
+    if (--block->liveCount == 0)
+    {
+        ::operator delete(block->memory, block->alignment);
+        delete block;
+    }
+}
+
 } // namespace Axion
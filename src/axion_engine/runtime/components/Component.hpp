@@ -1,10 +1,20 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
 #include "axion_engine/core/EngineContext.hpp"
 
 namespace Axion
 {
 
 class GameObject;
+class ComponentWriter;
+class ComponentReader;
+class StateWriter;
+class StateReader;
 
 /**
  * @brief Base class for all components that can be attached to GameObjects.
@@ -16,8 +26,22 @@ class GameObject;
 class Component
 {
 public:
+    Component() = default;
     virtual ~Component() = default;
 
+    /**
+     * @brief Copies the component's settings, not its bindings.
+     *
+     * The copy has no owner and is not registered anywhere; this is what
+     * Prefab relies on to clone prototypes.
+     */
+    Component(const Component& other) : enabled_(other.enabled_), enableCallbacks_(other.enableCallbacks_) {}
+    Component& operator=(const Component& other)
+    {
+        enabled_ = other.enabled_;
+        return *this;
+    }
+
     /**
      * @brief Binds this component to a GameObject.
      * @param owner The GameObject that owns this component
@@ -27,20 +51,141 @@ public:
     /** @brief Returns the GameObject that owns this component. */
     GameObject* GetOwner() const { return owner_; }
 
+    /**
+     * @brief Enables or disables this component alone.
+     *
+     * A disabled component gets no updates and no enable callbacks, whatever
+     * the state of its GameObject. OnEnabled()/OnDisabled() run when the
+     * component's effective state (see IsActive()) changes.
+     */
+    void SetEnabled(bool enabled);
+
+    /** @brief Returns whether this component itself is enabled. */
+    bool IsEnabled() const { return enabled_; }
+
+    /** @brief Returns true if this component and its GameObject are enabled and alive. */
+    bool IsActive() const;
+
     /** @brief Called when the component is first added to the scene. */
     virtual void OnMounted(EngineContext& context) {}
     
     /** @brief Called when the component is being destroyed. */
     virtual void OnDestroy(EngineContext& context) {}
 
-    /** @brief Called when the owning GameObject is enabled. */
+    /**
+     * @brief Called when the component becomes active (see IsActive()).
+     * @note Only component types that override OnEnabled() or OnDisabled()
+     *       are called; enabling a GameObject skips the others.
+     */
     virtual void OnEnabled(EngineContext& context) {}
     
-    /** @brief Called when the owning GameObject is disabled. */
+    /** @brief Called when the component stops being active. */
     virtual void OnDisabled(EngineContext& context) {}
 
+    /**
+     * @brief Called when a pooled GameObject is reused (see Scene::Acquire()).
+     *
+     * Override to clear per-use state (timers, health, velocities) before the
+     * object is enabled again. OnMounted() is not called again for reused objects.
+     */
+    virtual void OnReset(EngineContext& context) {}
+
+    /**
+     * @brief Writes the component's settings to a scene file.
+     *
+     * Only types registered in ComponentRegistry are saved. Runtime state
+     * (velocities, caches, bindings) is usually left out.
+     */
+    virtual void Serialize(ComponentWriter& writer) const {}
+
+    /**
+     * @brief Reads back what Serialize() wrote, in the same order.
+     * @note Called on an unmounted component, before OnMounted().
+     */
+    virtual void Deserialize(ComponentReader& reader) {}
+
+    /**
+     * @brief Writes the state a scene snapshot must restore.
+     *
+     * Unlike Serialize(), this is about what changes while playing
+     * (positions, velocities, script variables) and runs every captured
+     * frame, so keep it small. See Scene::CaptureSnapshot().
+     */
+    virtual void SaveState(StateWriter& writer) const {}
+
+    /** @brief Reads back what SaveState() wrote, in the same order. */
+    virtual void LoadState(StateReader& reader) {}
+
+protected:
+    /**
+     * @brief Tells the scene that this renderable's sort key or bounds changed.
+     *
+     * Renderers call it from setters that affect the layer, order, texture
+     * or size (see RenderQueue); movement is tracked by the scene itself.
+     */
+    void MarkRenderDirty();
+
 private:
+    friend class UpdateBuckets;
+    friend class RenderQueue;
+    friend class GameObject;
+    friend class Prefab;
+    friend class ComponentRegistry;
+
+    // Called wherever the concrete type is known (AddComponent, Prefab,
+    // ComponentRegistry); prefab clones inherit it through the copy constructor
+    template <typename T>
+    void DetectEnableCallbacks()
+    {
+        using Callback = void (Component::*)(EngineContext&);
+        enableCallbacks_ = !std::is_same_v<decltype(&T::OnEnabled), Callback> ||
+                           !std::is_same_v<decltype(&T::OnDisabled), Callback>;
+    }
+
+    // Slot in the scene's update lists (see UpdateBuckets)
+    enum class UpdateState : uint8_t
+    {
+        None,
+        PendingStart,
+        Active
+    };
+
     GameObject* owner_ = nullptr;
+    UpdateState updateState_ = UpdateState::None;
+    uint32_t updateBucket_ = 0;
+    uint32_t updateIndex_ = 0;
+    uint32_t renderSlot_ = UINT32_MAX; // Slot in the scene's RenderQueue
+    bool enabled_ = true;
+    bool enableCallbacks_ = true; // Type overrides OnEnabled() or OnDisabled()
 };
 
+/**
+ * @brief Storage shared by components cloned together in one batch.
+ *
+ * Freed once the last component living in it is destroyed.
+ */
+struct ComponentBlock
+{
+    void* memory = nullptr;
+    std::align_val_t alignment{alignof(std::max_align_t)};
+    size_t liveCount = 0;
+};
+
+/**
+ * @brief Deleter for GameObject components.
+ *
+ * Components created with AddComponent() are heap allocated and deleted.
+ * Components cloned from a Prefab live in a shared ComponentBlock: they are
+ * only destructed, and the block is released with its last component.
+ */
+struct ComponentDeleter
+{
+    ComponentBlock* block = nullptr;
+
+    void operator()(Component* component) const;
+};
+
+/** @brief Owning pointer to a component. */
+using ComponentPtr = std::unique_ptr<Component, ComponentDeleter>;
+
 } // namespace Axion
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include "axion_engine/runtime/components/Component.hpp"
+#include "axion_engine/runtime/classes/serialization/ComponentArchive.hpp"
 
 namespace Axion
 {
@@ -85,6 +86,28 @@ public:
         return GetProjectionMatrix() * GetViewMatrix();
     }
 
+    void Serialize(ComponentWriter& writer) const override
+    {
+        writer.Write(projectionType_);
+        writer.Write(nearPlane_);
+        writer.Write(farPlane_);
+        writer.Write(fovRadians_);
+        writer.Write(aspect_);
+        writer.Write(orthoWidth_);
+        writer.Write(orthoHeight_);
+    }
+
+    void Deserialize(ComponentReader& reader) override
+    {
+        reader.Read(projectionType_);
+        reader.Read(nearPlane_);
+        reader.Read(farPlane_);
+        reader.Read(fovRadians_);
+        reader.Read(aspect_);
+        reader.Read(orthoWidth_);
+        reader.Read(orthoHeight_);
+    }
+
 private:
     ProjectionType projectionType_ = ProjectionType::Orthographic;
 
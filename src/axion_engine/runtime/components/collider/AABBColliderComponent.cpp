@@ -18,7 +18,7 @@ glm::vec3 AABBColliderComponent::GetSize() const
     if (!owner) return size_;
     auto* transform = owner->GetTransform();
     if (!transform) return size_;
-    return size_ * transform->GetScale();
+    return size_ * transform->GetWorldScale();
 }
 
 void AABBColliderComponent::GetMinMax2D(glm::vec2& outMin, glm::vec2& outMax) const
@@ -158,7 +158,7 @@ bool AABBColliderComponent::IntersectsWithOBB(const OBBColliderComponent& other,
 void AABBColliderComponent::Render(const RenderContext& ctx)
 {
     auto* tr = GetOwner()->GetTransform();
-    if (!tr || !ctx.camera || !ctx.renderer)
+    if (!tr || !ctx.commands)
         return;
 
     const glm::vec3 center3 = tr->GetWorldPosition();
@@ -172,34 +172,20 @@ void AABBColliderComponent::Render(const RenderContext& ctx)
     const glm::vec2 w2(center.x + half.x, center.y + half.y);
     const glm::vec2 w3(center.x - half.x, center.y + half.y);
 
-    const glm::vec3 camWorldPos3 = ctx.camera->GetOwner()->GetTransform()->GetWorldPosition();
-    const glm::vec2 camWorldPos(camWorldPos3.x, camWorldPos3.y);
+    const glm::vec2 s0 = ctx.WorldToScreenUnflipped(w0);
+    const glm::vec2 s1 = ctx.WorldToScreenUnflipped(w1);
+    const glm::vec2 s2 = ctx.WorldToScreenUnflipped(w2);
+    const glm::vec2 s3 = ctx.WorldToScreenUnflipped(w3);
 
-    auto WorldToScreen2D = [&](const glm::vec2& p) -> glm::vec2
-    {
-        const float x = (p.x - camWorldPos.x) * 1.0f + ctx.windowWidth * 0.5f;
-        const float y = (p.y - camWorldPos.y) * 1.0f + ctx.windowHeight * 0.5f;
-        return {x, y};
-    };
-
-    const glm::vec2 s0 = WorldToScreen2D(w0);
-    const glm::vec2 s1 = WorldToScreen2D(w1);
-    const glm::vec2 s2 = WorldToScreen2D(w2);
-    const glm::vec2 s3 = WorldToScreen2D(w3);
-
-    if (IsTrigger())
-        SDL_SetRenderDrawColor(ctx.renderer, 0, 255, 255, 255);
-    else
-        SDL_SetRenderDrawColor(ctx.renderer, 0, 255, 0, 255);
+    // Truncated to whole pixels, as the integer SDL calls used to
+    auto Pixel = [](const glm::vec2& p) { return SDL_FPoint{(float)(int)p.x, (float)(int)p.y}; };
 
-    SDL_RenderDrawLine(ctx.renderer, (int)s0.x, (int)s0.y, (int)s1.x, (int)s1.y);
-    SDL_RenderDrawLine(ctx.renderer, (int)s1.x, (int)s1.y, (int)s2.x, (int)s2.y);
-    SDL_RenderDrawLine(ctx.renderer, (int)s2.x, (int)s2.y, (int)s3.x, (int)s3.y);
-    SDL_RenderDrawLine(ctx.renderer, (int)s3.x, (int)s3.y, (int)s0.x, (int)s0.y);
+    const SDL_FPoint outline[5] = {Pixel(s0), Pixel(s1), Pixel(s2), Pixel(s3), Pixel(s0)};
+    ctx.commands->AddLines(outline, 5, IsTrigger() ? SDL_Color{0, 255, 255, 255} : SDL_Color{0, 255, 0, 255});
 
-    SDL_SetRenderDrawColor(ctx.renderer, 255, 0, 0, 255);
-    const glm::vec2 sc = WorldToScreen2D(center);
-    SDL_RenderDrawPoint(ctx.renderer, (int)sc.x, (int)sc.y);
+    const glm::vec2 sc = ctx.WorldToScreenUnflipped(center);
+    const SDL_FPoint centerPixel = Pixel(sc);
+    ctx.commands->AddPoints(&centerPixel, 1, SDL_Color{255, 0, 0, 255});
 }
 
 } // namespace Axion
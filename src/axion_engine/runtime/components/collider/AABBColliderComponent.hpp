@@ -38,6 +38,18 @@ public:
 
     void Render(const RenderContext& ctx) override;
 
+    void Serialize(ComponentWriter& writer) const override
+    {
+        ColliderComponent::Serialize(writer);
+        writer.Write(size_);
+    }
+
+    void Deserialize(ComponentReader& reader) override
+    {
+        ColliderComponent::Deserialize(reader);
+        reader.Read(size_);
+    }
+
 private:
     glm::vec3 size_{1.0f, 1.0f, 1.0f};
 
@@ -20,7 +20,7 @@ float CircleColliderComponent::GetRadius() const
     auto* transform = owner->GetTransform();
     if (!transform) return radius_;
 
-    const glm::vec3 s = transform->GetScale();
+    const glm::vec3 s = transform->GetWorldScale();
     const float uniform = std::max(s.x, s.y);
     return radius_ * uniform;
 }
@@ -94,48 +94,24 @@ void CircleColliderComponent::Render(const RenderContext& ctx)
     if (!owner || owner->IsDestroyed()) return;
 
     auto* transform = owner->GetTransform();
-    if (!transform || !ctx.camera || !ctx.renderer)
+    if (!transform || !ctx.commands)
         return;
 
-    auto* camOwner = ctx.camera->GetOwner();
-    if (!camOwner || camOwner->IsDestroyed()) return;
+    const glm::vec2 screenPos = ctx.WorldToScreen(glm::vec2(transform->GetWorldPosition()));
 
-    auto* camTransform = camOwner->GetTransform();
-    if (!camTransform) return;
-
-    const glm::vec3 worldPos = transform->GetWorldPosition();
-    const glm::vec3 camWorldPos = camTransform->GetWorldPosition();
-
-    auto WorldToScreen2D = [&](const glm::vec3& p) -> glm::vec2
-    {
-        const float x = (p.x - camWorldPos.x) * 1.0f + ctx.windowWidth * 0.5f;
-        const float y = ctx.windowHeight * 0.5f - (p.y - camWorldPos.y) * 1.0f;
-        return {x, y};
-    };
-
-    const glm::vec2 screenPos = WorldToScreen2D(worldPos);
-
-    const float worldRadius = GetRadius();
-    const glm::vec3 radiusWorldPoint = worldPos + glm::vec3(worldRadius, 0.0f, 0.0f);
-
-    const glm::vec2 radiusScreenPoint = WorldToScreen2D(radiusWorldPoint);
-
-    int screenRadius = (int)glm::abs(radiusScreenPoint.x - screenPos.x);
+    int screenRadius = (int)glm::abs(GetRadius() * ctx.zoom);
     if (screenRadius < 1)
         screenRadius = 1;
 
-    if (IsTrigger())
-        SDL_SetRenderDrawColor(ctx.renderer, 0, 255, 255, 255);
-    else
-        SDL_SetRenderDrawColor(ctx.renderer, 0, 255, 0, 255);
-
-    DrawCircle(ctx, (int)screenPos.x, (int)screenPos.y, screenRadius);
+    const SDL_Color outline = IsTrigger() ? SDL_Color{0, 255, 255, 255} : SDL_Color{0, 255, 0, 255};
+    DrawCircle(ctx, (int)screenPos.x, (int)screenPos.y, screenRadius, outline);
 
-    SDL_SetRenderDrawColor(ctx.renderer, 255, 0, 0, 255);
-    SDL_RenderDrawPoint(ctx.renderer, (int)screenPos.x, (int)screenPos.y);
+    const SDL_FPoint center{(float)(int)screenPos.x, (float)(int)screenPos.y};
+    ctx.commands->AddPoints(&center, 1, SDL_Color{255, 0, 0, 255});
 }
 
-void CircleColliderComponent::DrawCircle(const RenderContext& ctx, int centerX, int centerY, int radius)
+void CircleColliderComponent::DrawCircle(const RenderContext& ctx, int centerX, int centerY, int radius,
+                                         const SDL_Color& color)
 {
     int x = 0;
     int y = radius;
@@ -143,14 +119,12 @@ void CircleColliderComponent::DrawCircle(const RenderContext& ctx, int centerX,
 
     auto drawCirclePoints = [&](int cx, int cy, int x, int y)
     {
-        SDL_RenderDrawPoint(ctx.renderer, cx + x, cy + y);
-        SDL_RenderDrawPoint(ctx.renderer, cx - x, cy + y);
-        SDL_RenderDrawPoint(ctx.renderer, cx + x, cy - y);
-        SDL_RenderDrawPoint(ctx.renderer, cx - x, cy - y);
-        SDL_RenderDrawPoint(ctx.renderer, cx + y, cy + x);
-        SDL_RenderDrawPoint(ctx.renderer, cx - y, cy + x);
-        SDL_RenderDrawPoint(ctx.renderer, cx + y, cy - x);
-        SDL_RenderDrawPoint(ctx.renderer, cx - y, cy - x);
+        const SDL_FPoint points[8] = {
+            {(float)(cx + x), (float)(cy + y)}, {(float)(cx - x), (float)(cy + y)},
+            {(float)(cx + x), (float)(cy - y)}, {(float)(cx - x), (float)(cy - y)},
+            {(float)(cx + y), (float)(cy + x)}, {(float)(cx - y), (float)(cy + x)},
+            {(float)(cx + y), (float)(cy - x)}, {(float)(cx - y), (float)(cy - x)}};
+        ctx.commands->AddPoints(points, 8, color);
     };
 
     while (y >= x)
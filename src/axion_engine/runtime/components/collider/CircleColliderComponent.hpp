@@ -37,10 +37,22 @@ public:
 
     void Render(const RenderContext& ctx) override;
 
+    void Serialize(ComponentWriter& writer) const override
+    {
+        ColliderComponent::Serialize(writer);
+        writer.Write(radius_);
+    }
+
+    void Deserialize(ComponentReader& reader) override
+    {
+        ColliderComponent::Deserialize(reader);
+        reader.Read(radius_);
+    }
+
 private:
     float radius_ = 1.0f;
 
-    void DrawCircle(const RenderContext& ctx, int centerX, int centerY, int radius);
+    void DrawCircle(const RenderContext& ctx, int centerX, int centerY, int radius, const SDL_Color& color);
 };
 
 } // namespace Axion
\ No newline at end of file
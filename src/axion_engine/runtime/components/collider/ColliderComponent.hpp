@@ -2,6 +2,7 @@
 
 #include "axion_engine/runtime/components/Component.hpp"
 #include "axion_engine/runtime/interfaces/IRenderable.hpp"
+#include "axion_engine/runtime/classes/serialization/ComponentArchive.hpp"
 #include "ColliderHelpers.hpp"
 
 namespace Axion
@@ -105,6 +106,12 @@ public:
     RenderLayer GetLayer() const override { return RenderLayer::Debug; }
     int GetOrderInLayer() const override { return 0; }
 
+    /** @brief Writes the collider type; derived colliders append their shape. */
+    void Serialize(ComponentWriter& writer) const override { writer.Write(type_); }
+
+    /** @brief Reads the collider type. */
+    void Deserialize(ComponentReader& reader) override { reader.Read(type_); }
+
 protected:
     ColliderType type_ = ColliderType::Trigger;
     ColliderShape shape_ = ColliderShape::Undefined;
@@ -18,7 +18,7 @@ glm::vec3 OBBColliderComponent::GetSize() const
     if (!owner) return size_;
     auto* transform = owner->GetTransform();
     if (!transform) return size_;
-    return size_ * transform->GetScale();
+    return size_ * transform->GetWorldScale();
 }
 
 glm::vec2 OBBColliderComponent::GetHalfExtents2D() const
@@ -27,7 +27,7 @@ glm::vec2 OBBColliderComponent::GetHalfExtents2D() const
     if (!owner) return {size_.x * 0.5f, size_.y * 0.5f};
     auto* transform = owner->GetTransform();
     if (!transform) return {size_.x * 0.5f, size_.y * 0.5f};
-    const glm::vec3 s = size_ * transform->GetScale();
+    const glm::vec3 s = size_ * transform->GetWorldScale();
     return {s.x * 0.5f, s.y * 0.5f};
 }
 
@@ -45,17 +45,20 @@ void OBBColliderComponent::GetAxes2D(glm::vec2& axisX, glm::vec2& axisY) const
 {
     auto* owner = GetOwner();
     auto* tr = owner ? owner->GetTransform() : nullptr;
-    const float deg = tr ? tr->GetWorldRotation().z : 0.0f;
+    if (!tr)
+    {
+        axisX = glm::vec2(1.0f, 0.0f);
+        axisY = glm::vec2(0.0f, 1.0f);
+        return;
+    }
 
-    const float rad = DegToRad(deg);
-    const float c = std::cos(rad);
-    const float s = std::sin(rad);
+    // Rotation direction read from the cached world affine, no trig needed
+    const glm::vec2 dir = glm::normalize(tr->GetWorldAffine2D().GetAxisX());
+    const float c = dir.x;
+    const float s = dir.y;
 
     axisX = glm::vec2(c, -s);
     axisY = glm::vec2(s, c);
-
-    axisX = glm::normalize(axisX);
-    axisY = glm::normalize(axisY);
 }
 
 bool OBBColliderComponent::Intersects(const ColliderComponent& other, Manifold& out) const
@@ -164,7 +167,7 @@ bool OBBColliderComponent::IntersectsWithOBB(const OBBColliderComponent& other,
 void OBBColliderComponent::Render(const RenderContext& ctx)
 {
     auto* tr = GetOwner()->GetTransform();
-    if (!tr || !ctx.camera || !ctx.renderer)
+    if (!tr || !ctx.commands)
         return;
 
     const glm::vec3 center3 = tr->GetWorldPosition();
@@ -181,34 +184,20 @@ void OBBColliderComponent::Render(const RenderContext& ctx)
     const glm::vec2 w2 = center + ax * (half.x) + ay * (half.y);
     const glm::vec2 w3 = center + ax * (-half.x) + ay * (half.y);
 
-    const glm::vec3 camWorldPos3 = ctx.camera->GetOwner()->GetTransform()->GetWorldPosition();
-    const glm::vec2 camWorldPos(camWorldPos3.x, camWorldPos3.y);
+    const glm::vec2 s0 = ctx.WorldToScreen(w0);
+    const glm::vec2 s1 = ctx.WorldToScreen(w1);
+    const glm::vec2 s2 = ctx.WorldToScreen(w2);
+    const glm::vec2 s3 = ctx.WorldToScreen(w3);
 
-    auto WorldToScreen2D = [&](const glm::vec2& p) -> glm::vec2
-    {
-        const float x = (p.x - camWorldPos.x) * 1.0f + ctx.windowWidth * 0.5f;
-        const float y = ctx.windowHeight * 0.5f - (p.y - camWorldPos.y) * 1.0f;
-        return {x, y};
-    };
-
-    const glm::vec2 s0 = WorldToScreen2D(w0);
-    const glm::vec2 s1 = WorldToScreen2D(w1);
-    const glm::vec2 s2 = WorldToScreen2D(w2);
-    const glm::vec2 s3 = WorldToScreen2D(w3);
-
-    if (IsTrigger())
-        SDL_SetRenderDrawColor(ctx.renderer, 0, 255, 255, 255);
-    else
-        SDL_SetRenderDrawColor(ctx.renderer, 0, 255, 0, 255);
+    // Truncated to whole pixels, as the integer SDL calls used to
+    auto Pixel = [](const glm::vec2& p) { return SDL_FPoint{(float)(int)p.x, (float)(int)p.y}; };
 
-    SDL_RenderDrawLine(ctx.renderer, (int)s0.x, (int)s0.y, (int)s1.x, (int)s1.y);
-    SDL_RenderDrawLine(ctx.renderer, (int)s1.x, (int)s1.y, (int)s2.x, (int)s2.y);
-    SDL_RenderDrawLine(ctx.renderer, (int)s2.x, (int)s2.y, (int)s3.x, (int)s3.y);
-    SDL_RenderDrawLine(ctx.renderer, (int)s3.x, (int)s3.y, (int)s0.x, (int)s0.y);
+    const SDL_FPoint outline[5] = {Pixel(s0), Pixel(s1), Pixel(s2), Pixel(s3), Pixel(s0)};
+    ctx.commands->AddLines(outline, 5, IsTrigger() ? SDL_Color{0, 255, 255, 255} : SDL_Color{0, 255, 0, 255});
 
-    SDL_SetRenderDrawColor(ctx.renderer, 255, 0, 0, 255);
-    const glm::vec2 sc = WorldToScreen2D(center);
-    SDL_RenderDrawPoint(ctx.renderer, (int)sc.x, (int)sc.y);
+    const glm::vec2 sc = ctx.WorldToScreen(center);
+    const SDL_FPoint centerPixel = Pixel(sc);
+    ctx.commands->AddPoints(&centerPixel, 1, SDL_Color{255, 0, 0, 255});
 }
 
 } // namespace Axion
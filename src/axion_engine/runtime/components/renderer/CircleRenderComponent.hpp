@@ -8,14 +8,15 @@ namespace Axion
 /**
  * @brief Solid colored circle rendering component.
  *
- * Renders a filled circle using point-based rendering.
+ * Renders a filled circle as a triangle fan whose segment count follows
+ * its size on screen, batched with the other untextured geometry.
  */
 class CircleRenderComponent : public RenderComponent
 {
 public:
     void Render(const RenderContext& ctx) override
     {
-        if (!ctx.renderer)
+        if (!ctx.commands)
             return;
 
         auto* owner = GetOwner();
@@ -26,52 +27,35 @@ public:
         if (!tr)
             return;
 
-        if (!ctx.camera)
-            return;
-
-        auto* camOwner = ctx.camera->GetOwner();
-        if (!camOwner || camOwner->IsDestroyed())
-            return;
-
-        auto* camTr = camOwner->GetTransform();
-        glm::vec3 camPos = camTr ? camTr->GetWorldPosition() : glm::vec3(0.0f);
-
-        int winW = 0, winH = 0;
-        SDL_GetRendererOutputSize(ctx.renderer, &winW, &winH);
+        const glm::vec2 screen = ctx.WorldToScreen(tr->GetWorldAffine2D().GetTranslation());
+        const float scale = std::abs(tr->GetWorldScale().x);
+        const float screenRadius = radius_ * scale * ctx.zoom;
 
-        const glm::mat4 worldMatrix = tr->GetWorldMatrix();
-        const glm::vec3 worldPos = glm::vec3(worldMatrix[3]);
-
-        glm::vec3 basisX = glm::vec3(worldMatrix[0]);
-        float scale = glm::length(basisX);
-
-        float zoom = 1.0f;
-        float screenX = (worldPos.x - camPos.x) * zoom + winW * 0.5f;
-        float screenY = winH * 0.5f - (worldPos.y - camPos.y) * zoom;
-
-        float screenRadius = radius_ * scale * zoom;
+        ctx.commands->AddCircle({screen.x, screen.y}, screenRadius, color_);
+    }
 
-        SDL_SetRenderDrawColor(ctx.renderer, color_.r, color_.g, color_.b, color_.a);
+    bool GetWorldBounds(glm::vec2& min, glm::vec2& max) const override
+    {
+        auto* tr = GetOwner() ? GetOwner()->GetTransform() : nullptr;
+        if (!tr)
+            return false;
 
-        for (int w = 0; w < screenRadius * 2; w++)
-        {
-            for (int h = 0; h < screenRadius * 2; h++)
-            {
-                int dx = w - static_cast<int>(screenRadius);
-                int dy = h - static_cast<int>(screenRadius);
-                if ((dx * dx + dy * dy) <= static_cast<int>(screenRadius * screenRadius))
-                {
-                    SDL_RenderDrawPoint(ctx.renderer, static_cast<int>(screenX + dx), static_cast<int>(screenY + dy));
-                }
-            }
-        }
+        const glm::vec2 center = tr->GetWorldAffine2D().GetTranslation();
+        const float radius = radius_ * std::abs(tr->GetWorldScale().x);
+        min = center - glm::vec2(radius);
+        max = center + glm::vec2(radius);
+        return true;
     }
 
     /**
      * @brief Set the base radius.
      * @param r Radius value.
      */
-    void SetRadius(float r) { radius_ = r; }
+    void SetRadius(float r)
+    {
+        radius_ = r;
+        MarkRenderDirty();
+    }
 
     /**
      * @brief Get the effective radius (scaled by transform).
@@ -83,7 +67,7 @@ public:
         if (!owner) return radius_;
         auto* tr = owner->GetTransform();
         if (!tr) return radius_;
-        const glm::vec3 s = tr->GetScale();
+        const glm::vec3 s = tr->GetWorldScale();
         const float uniform = std::max(s.x, s.y);
         return radius_ * uniform;
     }
@@ -96,6 +80,20 @@ public:
 
     SDL_Color GetColor() const { return color_; }
 
+    void Serialize(ComponentWriter& writer) const override
+    {
+        RenderComponent::Serialize(writer);
+        writer.Write(radius_);
+        writer.Write(color_);
+    }
+
+    void Deserialize(ComponentReader& reader) override
+    {
+        RenderComponent::Deserialize(reader);
+        reader.Read(radius_);
+        reader.Read(color_);
+    }
+
 private:
     float radius_ = 50.0f;
     SDL_Color color_ = {255, 255, 255, 255};
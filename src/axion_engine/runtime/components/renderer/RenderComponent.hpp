@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "axion_engine/runtime/components/Component.hpp"
+#include "axion_engine/runtime/classes/serialization/ComponentArchive.hpp"
 #include "axion_engine/runtime/interfaces/IRenderable.hpp"
 
 namespace Axion
@@ -23,20 +24,69 @@ public:
     virtual void Render(const RenderContext& ctx) = 0;
 
     /** @brief Sets the render layer. */
-    void SetLayer(RenderLayer l) { layer_ = l; }
+    void SetLayer(RenderLayer l)
+    {
+        layer_ = l;
+        MarkRenderDirty();
+    }
     
     /** @brief Returns the render layer. */
     RenderLayer GetLayer() const override { return layer_; }
 
     /** @brief Sets the order within the layer (lower = rendered first). */
-    void SetOrderInLayer(int o) { orderInLayer_ = o; }
+    void SetOrderInLayer(int o)
+    {
+        orderInLayer_ = o;
+        MarkRenderDirty();
+    }
     
     /** @brief Returns the order within the layer. */
     int GetOrderInLayer() const override { return orderInLayer_; }
 
+    /**
+     * @brief Bakes this renderer into the static layer (see IRenderable::IsStatic()).
+     *
+     * Meant for scenery that rarely changes. Moving it or changing its layer,
+     * order or texture, or enabling or disabling it or its object, re-bakes it
+     * automatically; call MarkRenderDirty() after other visual changes (color).
+     *
+     * Ignored by renderers that cannot be baked (see CanBakeStatic()).
+     */
+    void SetStatic(bool isStatic)
+    {
+        isStatic_ = isStatic;
+        MarkRenderDirty();
+    }
+
+    /** @brief Returns true if this renderer is baked into the static layer. */
+    bool IsStatic() const override { return isStatic_ && CanBakeStatic(); }
+
+    /** @brief Writes the layer and order; derived renderers append their settings. */
+    void Serialize(ComponentWriter& writer) const override
+    {
+        writer.Write(layer_);
+        writer.Write(orderInLayer_);
+    }
+
+    /** @brief Reads the layer and order. */
+    void Deserialize(ComponentReader& reader) override
+    {
+        reader.Read(layer_);
+        reader.Read(orderInLayer_);
+    }
+
 protected:
+    /**
+     * @brief Returns false for renderers the static layer cannot bake.
+     *
+     * Chunks are composited with the Y-up world mapping, so renderers drawn
+     * through RenderContext::WorldToScreenUnflipped() would come out flipped.
+     */
+    virtual bool CanBakeStatic() const { return true; }
+
     RenderLayer layer_ = RenderLayer::Default;
     int orderInLayer_ = 0;
+    bool isStatic_ = false;
 };
 
 } // namespace Axion
\ No newline at end of file
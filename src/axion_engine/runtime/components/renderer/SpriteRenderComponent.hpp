@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cmath>
+
 #include <SDL.h>
 #include <glm/glm.hpp>
 
 #include "RenderComponent.hpp"
 #include "axion_engine/runtime/components/transform/TransformComponent.hpp"
+#include "axion_engine/managers/assets/SpriteHandle.hpp"
 
 namespace Axion
 {
@@ -13,7 +16,9 @@ namespace Axion
  * @brief Sprite rendering component for textured 2D objects.
  *
  * Renders an SDL texture with support for source rectangles,
- * color modulation, custom sizing, and rotation.
+ * color modulation, custom sizing, and rotation. Sprites are drawn as
+ * quads into the frame's RenderCommandList, so consecutive sprites sharing
+ * a texture cost a single draw call.
  */
 class SpriteRenderComponent : public RenderComponent
 {
@@ -22,7 +27,12 @@ public:
      * @brief Set the texture to render.
      * @param tex SDL texture pointer (ownership not transferred).
      */
-    void SetTexture(SDL_Texture* tex) { texture_ = tex; }
+    void SetTexture(SDL_Texture* tex)
+    {
+        texture_ = tex;
+        CacheTextureSize();
+        MarkRenderDirty();
+    }
 
     /**
      * @brief Get the current texture.
@@ -30,6 +40,20 @@ public:
      */
     SDL_Texture* GetTexture() const { return texture_; }
 
+    /**
+     * @brief Set the texture and source rectangle of a packed sprite.
+     * @param sprite Sprite from AssetsManager::GetSprite().
+     */
+    void SetSprite(const SpriteHandle& sprite)
+    {
+        texture_ = sprite.texture;
+        texW_ = sprite.textureWidth;
+        texH_ = sprite.textureHeight;
+        if (texture_ && (texW_ <= 0 || texH_ <= 0))
+            CacheTextureSize();
+        SetSourceRect(sprite.rect);
+    }
+
     /**
      * @brief Set a source rectangle for texture sampling.
      * @param r The source rectangle in texture coordinates.
@@ -38,6 +62,7 @@ public:
     {
         srcRect_ = r;
         hasSrcRect_ = true;
+        MarkRenderDirty();
     }
 
     /**
@@ -50,7 +75,11 @@ public:
      * @brief Set the display size in world units.
      * @param size Width and height.
      */
-    void SetSize(const glm::vec2& size) { size_ = size; }
+    void SetSize(const glm::vec2& size)
+    {
+        size_ = size;
+        MarkRenderDirty();
+    }
 
     glm::vec2 GetSize() const { return size_; }
     SDL_Color GetColor() const { return color_; }
@@ -59,71 +88,116 @@ public:
 
     void Render(const RenderContext& ctx) override
     {
-        if (!texture_ || !ctx.renderer || !ctx.camera)
+        if (!texture_ || !ctx.commands || texW_ <= 0 || texH_ <= 0)
             return;
 
         auto* tr = GetOwner()->GetComponent<TransformComponent>();
         if (!tr)
             return;
 
-        auto* camTr = ctx.camera->GetOwner()->GetTransform();
-        glm::vec3 camPos = camTr ? camTr->GetWorldPosition() : glm::vec3(0.0f);
+        const glm::vec2 screen = ctx.WorldToScreen(tr->GetWorldAffine2D().GetTranslation());
+        const float screenX = screen.x;
+        const float screenY = screen.y;
 
-        int winW = 0, winH = 0;
-        SDL_GetRendererOutputSize(ctx.renderer, &winW, &winH);
+        float angleDeg = -tr->GetWorldRotation().z;
 
-        const glm::mat4 worldMatrix = tr->GetWorldMatrix();
-        const glm::vec3 worldPos = glm::vec3(worldMatrix[3]);
+        const SDL_Rect src = hasSrcRect_ ? srcRect_ : SDL_Rect{0, 0, texW_, texH_};
 
-        glm::vec3 basisX = glm::vec3(worldMatrix[0]);
-        glm::vec3 basisY = glm::vec3(worldMatrix[1]);
-        float scaleX = glm::length(basisX);
-        float scaleY = glm::length(basisY);
+        const glm::vec2 drawSize = GetDrawSize(*tr, src.w, src.h) * ctx.zoom;
+        const float dstW = drawSize.x;
+        const float dstH = drawSize.y;
 
-        float angleRad = std::atan2(worldMatrix[0][1], worldMatrix[0][0]);
-        float angleDeg = -glm::degrees(angleRad);
+        // Corners rotated clockwise on screen around the center, as SDL_RenderCopyEx does
+        const float radians = glm::radians(angleDeg);
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        const float hw = dstW * 0.5f;
+        const float hh = dstH * 0.5f;
+        const glm::vec2 local[4] = {{-hw, -hh}, {hw, -hh}, {hw, hh}, {-hw, hh}};
 
-        float zoom = 1.0f;
-        float screenX = (worldPos.x - camPos.x) * zoom + winW * 0.5f;
-        float screenY = winH * 0.5f - (worldPos.y - camPos.y) * zoom;
-
-        SDL_Rect src;
-        if (hasSrcRect_)
+        SDL_FPoint positions[4];
+        for (int i = 0; i < 4; ++i)
         {
-            src = srcRect_;
-        }
-        else
-        {
-            int texW = 0, texH = 0;
-            SDL_QueryTexture(texture_, nullptr, nullptr, &texW, &texH);
-            src = {0, 0, texW, texH};
+            positions[i].x = screenX + local[i].x * c - local[i].y * s;
+            positions[i].y = screenY + local[i].x * s + local[i].y * c;
         }
 
-        glm::vec2 sizeWorld = size_ * glm::vec2(scaleX, scaleY);
-        float dstW = (size_.x > 0.0f) ? sizeWorld.x : src.w * scaleX;
-        float dstH = (size_.y > 0.0f) ? sizeWorld.y : src.h * scaleY;
-
-        SDL_FRect dst;
-        dst.w = dstW;
-        dst.h = dstH;
-        dst.x = screenX - dst.w * 0.5f;
-        dst.y = screenY - dst.h * 0.5f;
-
-        SDL_SetTextureColorMod(texture_, color_.r, color_.g, color_.b);
-        SDL_SetTextureAlphaMod(texture_, color_.a);
-
-        SDL_RenderCopyExF(
-            ctx.renderer,
-            texture_,
-            &src,
-            &dst,
-            angleDeg,
-            nullptr,
-            SDL_FLIP_NONE);
+        const float u0 = static_cast<float>(src.x) / texW_;
+        const float v0 = static_cast<float>(src.y) / texH_;
+        const float u1 = static_cast<float>(src.x + src.w) / texW_;
+        const float v1 = static_cast<float>(src.y + src.h) / texH_;
+        const SDL_FPoint uvs[4] = {{u0, v0}, {u1, v0}, {u1, v1}, {u0, v1}};
+
+        ctx.commands->AddQuad(texture_, positions, uvs, color_);
+    }
+
+    SDL_Texture* GetBatchTexture() const override { return texture_; }
+
+    bool GetWorldBounds(glm::vec2& min, glm::vec2& max) const override
+    {
+        auto* tr = GetOwner() ? GetOwner()->GetTransform() : nullptr;
+        if (!texture_ || !tr)
+            return false;
+
+        const int srcW = hasSrcRect_ ? srcRect_.w : texW_;
+        const int srcH = hasSrcRect_ ? srcRect_.h : texH_;
+
+        // Box of the rotated quad
+        const glm::vec2 half = GetDrawSize(*tr, srcW, srcH) * 0.5f;
+        const float radians = glm::radians(tr->GetWorldRotation().z);
+        const float c = std::abs(std::cos(radians));
+        const float s = std::abs(std::sin(radians));
+        const glm::vec2 extent(half.x * c + half.y * s, half.x * s + half.y * c);
+
+        const glm::vec2 center = tr->GetWorldAffine2D().GetTranslation();
+        min = center - extent;
+        max = center + extent;
+        return true;
+    }
+
+    void Serialize(ComponentWriter& writer) const override
+    {
+        RenderComponent::Serialize(writer);
+        writer.WriteTexture(texture_);
+        writer.Write(srcRect_);
+        writer.Write(hasSrcRect_);
+        writer.Write(color_);
+        writer.Write(size_);
+    }
+
+    void Deserialize(ComponentReader& reader) override
+    {
+        RenderComponent::Deserialize(reader);
+        texture_ = reader.ReadTexture();
+        CacheTextureSize();
+        reader.Read(srcRect_);
+        reader.Read(hasSrcRect_);
+        reader.Read(color_);
+        reader.Read(size_);
     }
 
 private:
+    // Queried when the texture is set, never while drawing
+    void CacheTextureSize()
+    {
+        texW_ = texH_ = 0;
+        if (texture_)
+            SDL_QueryTexture(texture_, nullptr, nullptr, &texW_, &texH_);
+    }
+
+    // Drawn size: the set size, or the source size where it is not set, times the world scale
+    glm::vec2 GetDrawSize(const TransformComponent& tr, int srcW, int srcH) const
+    {
+        const glm::vec3 worldScale = tr.GetWorldScale();
+        const float scaleX = std::abs(worldScale.x);
+        const float scaleY = std::abs(worldScale.y);
+        return {(size_.x > 0.0f ? size_.x : static_cast<float>(srcW)) * scaleX,
+                (size_.y > 0.0f ? size_.y : static_cast<float>(srcH)) * scaleY};
+    }
+
     SDL_Texture* texture_ = nullptr;
+    int texW_ = 0;
+    int texH_ = 0;
     SDL_Rect srcRect_{0, 0, 0, 0};
     bool hasSrcRect_ = false;
     SDL_Color color_{255, 255, 255, 255};
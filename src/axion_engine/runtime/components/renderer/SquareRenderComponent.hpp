@@ -8,67 +8,63 @@ namespace Axion
 /**
  * @brief Solid colored square rendering component.
  *
- * Renders a filled, rotatable square using SDL geometry rendering.
+ * Renders a filled, rotatable square using SDL geometry rendering,
+ * batched with the other untextured geometry of the frame.
  */
 class SquareRenderComponent : public RenderComponent
 {
 public:
     void Render(const RenderContext& ctx) override
     {
-        if (!ctx.renderer)
+        if (!ctx.commands)
             return;
 
         auto* tr = GetOwner()->GetComponent<TransformComponent>();
         if (!tr)
             return;
 
-        auto* camTr = ctx.camera->GetOwner()->GetTransform();
-        glm::vec3 camPos = camTr ? camTr->GetWorldPosition() : glm::vec3(0.0f);
+        const Affine2D& world = tr->GetWorldAffine2D();
 
-        int winW = 0, winH = 0;
-        SDL_GetRendererOutputSize(ctx.renderer, &winW, &winH);
-
-        const glm::mat4 worldMatrix = tr->GetWorldMatrix();
-        const glm::vec3 worldPos = glm::vec3(worldMatrix[3]);
-
-        glm::vec3 basisX = glm::vec3(worldMatrix[0]);
-        glm::vec3 basisY = glm::vec3(worldMatrix[1]);
-        float scaleX = glm::length(basisX);
-        float scaleY = glm::length(basisY);
-
-        float rotation = glm::radians(tr->GetRotation().z);
-
-        float zoom = 1.0f;
-        float screenX = (worldPos.x - camPos.x) * zoom + winW * 0.5f;
-        float screenY = (worldPos.y - camPos.y) * zoom + winH * 0.5f;
-
-        float halfW = (scaleX * zoom) * 0.5f;
-        float halfH = (scaleY * zoom) * 0.5f;
-
-        float cosR = std::cos(rotation);
-        float sinR = std::sin(rotation);
-
-        glm::vec2 corners[4] = {
-            {-halfW, -halfH},
-            {halfW, -halfH},
-            {halfW, halfH},
-            {-halfW, halfH}
+        // Unit square corners, transformed straight through the world affine
+        const glm::vec2 corners[4] = {
+            {-0.5f, -0.5f},
+            {0.5f, -0.5f},
+            {0.5f, 0.5f},
+            {-0.5f, 0.5f}
         };
 
         SDL_Vertex vertices[4];
         for (int i = 0; i < 4; ++i)
         {
-            float rotX = corners[i].x * cosR - corners[i].y * sinR;
-            float rotY = corners[i].x * sinR + corners[i].y * cosR;
+            const glm::vec2 p = ctx.WorldToScreenUnflipped(world.TransformPoint(corners[i]));
 
-            vertices[i].position.x = screenX + rotX;
-            vertices[i].position.y = screenY + rotY;
+            vertices[i].position.x = p.x;
+            vertices[i].position.y = p.y;
             vertices[i].color = color_;
+            vertices[i].tex_coord = {0.0f, 0.0f};
         }
 
         int indices[6] = {0, 1, 2, 0, 2, 3};
 
-        SDL_RenderGeometry(ctx.renderer, nullptr, vertices, 4, indices, 6);
+        ctx.commands->AddTriangles(nullptr, vertices, 4, indices, 6);
+    }
+
+    bool GetWorldBounds(glm::vec2& min, glm::vec2& max) const override
+    {
+        auto* tr = GetOwner() ? GetOwner()->GetTransform() : nullptr;
+        if (!tr)
+            return false;
+
+        const Affine2D& world = tr->GetWorldAffine2D();
+        min = max = world.TransformPoint({-0.5f, -0.5f});
+        const glm::vec2 corners[3] = {{0.5f, -0.5f}, {0.5f, 0.5f}, {-0.5f, 0.5f}};
+        for (const glm::vec2& corner : corners)
+        {
+            const glm::vec2 p = world.TransformPoint(corner);
+            min = glm::min(min, p);
+            max = glm::max(max, p);
+        }
+        return true;
     }
 
     /**
@@ -77,6 +73,22 @@ public:
      */
     void SetColor(const SDL_Color& color) { color_ = color; }
 
+    void Serialize(ComponentWriter& writer) const override
+    {
+        RenderComponent::Serialize(writer);
+        writer.Write(color_);
+    }
+
+    void Deserialize(ComponentReader& reader) override
+    {
+        RenderComponent::Deserialize(reader);
+        reader.Read(color_);
+    }
+
+protected:
+    // Drawn with the unflipped mapping
+    bool CanBakeStatic() const override { return false; }
+
 private:
     SDL_Color color_ = {255, 0, 0, 255};
 };
@@ -9,6 +9,7 @@
 
 #include "RenderComponent.hpp"
 #include "axion_engine/runtime/components/transform/TransformComponent.hpp"
+#include "axion_engine/managers/font/FontManager.hpp"
 
 namespace Axion
 {
@@ -16,21 +17,15 @@ namespace Axion
 /**
  * @brief Text rendering component using SDL_ttf.
  *
- * Renders UTF-8 text with configurable font, color, and size.
- * Caches the rendered texture for performance.
+ * Renders UTF-8 text with configurable font, color, and size. The text is
+ * laid out through the FontManager on the main thread in PrepareRender()
+ * and drawn as one quad per glyph from the shared glyph atlas, tinted by
+ * the text color.
  */
 class TextRenderComponent : public RenderComponent
 {
 public:
-    ~TextRenderComponent() override
-    {
-        DestroyTexture();
-        if (ownedFont_)
-        {
-            TTF_CloseFont(ownedFont_);
-            ownedFont_ = nullptr;
-        }
-    }
+    TextRenderComponent() = default;
 
     /**
      * @brief Set the text to display.
@@ -42,17 +37,14 @@ public:
             return;
         text_ = text;
         dirty_ = true;
+        MarkRenderDirty(); // Unbounded until laid out again, so the stale bounds do not cull it
     }
 
     /**
      * @brief Set the text color.
      * @param color RGBA color.
      */
-    void SetColor(const SDL_Color& color)
-    {
-        color_ = color;
-        dirty_ = true;
-    }
+    void SetColor(const SDL_Color& color) { color_ = color; }
 
     /**
      * @brief Set an external font.
@@ -60,143 +52,152 @@ public:
      */
     void SetFont(TTF_Font* font)
     {
-        font_ = font;
+        externalFont_ = font;
         dirty_ = true;
+        MarkRenderDirty();
     }
 
     /**
-     * @brief Set the font size for auto-loaded fonts.
+     * @brief Set the font file.
+     * @param path Path relative to the assets folder, empty for the default font.
+     */
+    void SetFontPath(const std::string& path)
+    {
+        fontPath_ = path;
+        externalFont_ = nullptr;
+        dirty_ = true;
+        MarkRenderDirty();
+    }
+
+    /**
+     * @brief Set the font size for fonts loaded by path.
      * @param size Font size in points.
      */
     void SetFontSize(int size)
     {
         fontSize_ = size;
         dirty_ = true;
+        MarkRenderDirty();
     }
 
-    void Render(const RenderContext& ctx) override
+    void PrepareRender(EngineContext& context) override
     {
-        if (!ctx.renderer || !ctx.camera)
+        if (!dirty_ || !context.fonts)
             return;
 
-        auto* tr = GetOwner()->GetComponent<TransformComponent>();
-        if (!tr)
+        Font* font = externalFont_ ? context.fonts->GetFont(externalFont_)
+                                   : context.fonts->GetFont(fontPath_, fontSize_);
+        if (!font)
             return;
 
-        if (!font_ && !ownedFont_)
-        {
-            const char* fontPaths[] = {
-                "C:/Windows/Fonts/arial.ttf",
-                "C:/Windows/Fonts/calibri.ttf",
-                "C:/Windows/Fonts/segoeui.ttf"
-            };
-
-            for (const char* path : fontPaths)
-            {
-                ownedFont_ = TTF_OpenFont(path, fontSize_);
-                if (ownedFont_)
-                {
-                    font_ = ownedFont_;
-                    break;
-                }
-            }
+        context.fonts->Layout(*font, text_, layout_);
+        dirty_ = false;
+        MarkRenderDirty(); // Bounds and batch texture are known from now on
+    }
 
-            if (!font_)
-                return;
-        }
+    SDL_Texture* GetBatchTexture() const override
+    {
+        return layout_.quads.empty() ? nullptr : layout_.quads.front().texture;
+    }
 
-        if (!font_ || text_.empty())
+    void Render(const RenderContext& ctx) override
+    {
+        if (!ctx.commands || dirty_ || layout_.quads.empty())
             return;
 
-        if (dirty_ || !texture_)
-        {
-            if (!RebuildTexture(ctx.renderer))
-                return;
-        }
-
-        auto* camTr = ctx.camera->GetOwner()->GetTransform();
-        const glm::vec3 camPos = camTr ? camTr->GetWorldPosition() : glm::vec3(0.0f);
-
-        int winW = 0, winH = 0;
-        SDL_GetRendererOutputSize(ctx.renderer, &winW, &winH);
+        auto* tr = GetOwner()->GetComponent<TransformComponent>();
+        if (!tr)
+            return;
 
         const glm::vec3 worldPos = tr->GetWorldPosition();
         const float angleDeg = tr->GetWorldRotation().z;
 
         const glm::vec3 worldScale = tr->GetWorldScale();
-        const float sx = worldScale.x;
-        const float sy = worldScale.y;
-
-        const float zoom = 1.0f;
-        const float screenX = (worldPos.x - camPos.x) * zoom + winW * 0.5f;
-        const float screenY = (worldPos.y - camPos.y) * zoom + winH * 0.5f;
-
-        SDL_FRect dst;
-        dst.w = texW_ * sx;
-        dst.h = texH_ * sy;
-        dst.x = screenX - dst.w * 0.5f;
-        dst.y = screenY - dst.h * 0.5f;
-
-        SDL_FPoint pivot;
-        pivot.x = dst.w * 0.5f;
-        pivot.y = dst.h * 0.5f;
-
-        SDL_RenderCopyExF(
-            ctx.renderer,
-            texture_,
-            nullptr,
-            &dst,
-            static_cast<double>(angleDeg),
-            &pivot,
-            SDL_FLIP_NONE);
-    }
+        const float sx = worldScale.x * ctx.zoom;
+        const float sy = worldScale.y * ctx.zoom;
 
-private:
-    bool RebuildTexture(SDL_Renderer* renderer)
-    {
-        DestroyTexture();
+        const glm::vec2 screen = ctx.WorldToScreenUnflipped(glm::vec2(worldPos));
 
-        SDL_Surface* surf = TTF_RenderUTF8_Blended(font_, text_.c_str(), color_);
-        if (!surf)
-            return false;
+        // Text rotated clockwise on screen around its center, as SDL_RenderCopyEx does
+        const float radians = glm::radians(angleDeg);
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        const glm::vec2 half = layout_.size * 0.5f;
 
-        texture_ = SDL_CreateTextureFromSurface(renderer, surf);
-        texW_ = static_cast<float>(surf->w);
-        texH_ = static_cast<float>(surf->h);
+        for (const GlyphQuad& quad : layout_.quads)
+        {
+            const float left = (quad.rect.x - half.x) * sx;
+            const float top = (quad.rect.y - half.y) * sy;
+            const float right = left + quad.rect.w * sx;
+            const float bottom = top + quad.rect.h * sy;
+            const glm::vec2 local[4] = {{left, top}, {right, top}, {right, bottom}, {left, bottom}};
+
+            SDL_FPoint positions[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                positions[i].x = screen.x + local[i].x * c - local[i].y * s;
+                positions[i].y = screen.y + local[i].x * s + local[i].y * c;
+            }
 
-        SDL_FreeSurface(surf);
+            const SDL_FPoint uvs[4] = {
+                quad.uvMin, {quad.uvMax.x, quad.uvMin.y}, quad.uvMax, {quad.uvMin.x, quad.uvMax.y}};
+            ctx.commands->AddQuad(quad.texture, positions, uvs, color_);
+        }
+    }
 
-        if (!texture_)
+    bool GetWorldBounds(glm::vec2& min, glm::vec2& max) const override
+    {
+        // Unknown until the text has been laid out once
+        auto* tr = GetOwner() ? GetOwner()->GetTransform() : nullptr;
+        if (!tr || dirty_)
             return false;
 
-        SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
-
-        dirty_ = false;
+        const glm::vec3 worldScale = tr->GetWorldScale();
+        const glm::vec2 half(layout_.size.x * std::abs(worldScale.x) * 0.5f,
+                             layout_.size.y * std::abs(worldScale.y) * 0.5f);
+        const float radians = glm::radians(tr->GetWorldRotation().z);
+        const float c = std::abs(std::cos(radians));
+        const float s = std::abs(std::sin(radians));
+        const glm::vec2 extent(half.x * c + half.y * s, half.x * s + half.y * c);
+
+        const glm::vec2 center(tr->GetWorldPosition());
+        min = center - extent;
+        max = center + extent;
         return true;
     }
 
-    void DestroyTexture()
+    /** @brief Writes the text, color and font size; fonts are not saved. */
+    void Serialize(ComponentWriter& writer) const override
     {
-        if (texture_)
-        {
-            SDL_DestroyTexture(texture_);
-            texture_ = nullptr;
-        }
-        texW_ = 0.0f;
-        texH_ = 0.0f;
+        RenderComponent::Serialize(writer);
+        writer.WriteString(text_);
+        writer.Write(color_);
+        writer.Write(fontSize_);
     }
 
+    /** @brief Reads the text, color and font size; the default font is used. */
+    void Deserialize(ComponentReader& reader) override
+    {
+        RenderComponent::Deserialize(reader);
+        text_ = std::string(reader.ReadString());
+        reader.Read(color_);
+        reader.Read(fontSize_);
+        dirty_ = true;
+        MarkRenderDirty();
+    }
+
+protected:
+    // Drawn with the unflipped mapping
+    bool CanBakeStatic() const override { return false; }
+
 private:
     std::string text_;
     SDL_Color color_{255, 255, 255, 255};
     int fontSize_ = 16;
+    std::string fontPath_;            // Empty for the default font
+    TTF_Font* externalFont_ = nullptr;
 
-    TTF_Font* font_ = nullptr;
-    TTF_Font* ownedFont_ = nullptr;
-
-    SDL_Texture* texture_ = nullptr;
-    float texW_ = 0.0f;
-    float texH_ = 0.0f;
+    TextLayout layout_;
     bool dirty_ = true;
 };
 
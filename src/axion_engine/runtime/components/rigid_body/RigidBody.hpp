@@ -3,6 +3,8 @@
 #include <glm/glm.hpp>
 
 #include "axion_engine/runtime/components/Component.hpp"
+#include "axion_engine/runtime/classes/serialization/ComponentArchive.hpp"
+#include "axion_engine/runtime/classes/snapshot/ComponentState.hpp"
 
 namespace Axion
 {
@@ -107,6 +109,41 @@ public:
     /** @brief Returns the movement constraint flags. */
     RigidbodyLock GetLocks() const { return locks_; }
 
+    /** @brief Stops the body when its pooled GameObject is reused. */
+    void OnReset(EngineContext& context) override
+    {
+        velocity_ = glm::vec3(0.0f);
+        accumulatedForce_ = glm::vec3(0.0f);
+    }
+
+    /** @brief Writes mass, drag and locks; velocity is runtime state. */
+    void Serialize(ComponentWriter& writer) const override
+    {
+        writer.Write(mass);
+        writer.Write(drag);
+        writer.Write(locks_);
+    }
+
+    void Deserialize(ComponentReader& reader) override
+    {
+        reader.Read(mass);
+        reader.Read(drag);
+        reader.Read(locks_);
+    }
+
+    /** @brief Writes velocity and pending forces for snapshots. */
+    void SaveState(StateWriter& writer) const override
+    {
+        writer.Write(velocity_);
+        writer.Write(accumulatedForce_);
+    }
+
+    void LoadState(StateReader& reader) override
+    {
+        reader.Read(velocity_);
+        reader.Read(accumulatedForce_);
+    }
+
 private:
     glm::vec3 velocity_ = glm::vec3(0.0f);
     glm::vec3 accumulatedForce_ = glm::vec3(0.0f);
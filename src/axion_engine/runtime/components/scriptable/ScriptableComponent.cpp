@@ -0,0 +1,39 @@
+#include "ScriptableComponent.hpp"
+
+#include <algorithm>
+
+#include "axion_engine/runtime/classes/gameObject/GameObject.hpp"
+
+namespace Axion
+{
+
+void ScriptableComponent::SetUpdateInterval(uint32_t frames)
+{
+    if (frames <= 1)
+        SetUpdateEveryFrame();
+    else
+        SetUpdateFrequency(UpdateFrequency::EveryNFrames, frames, 0.0f);
+}
+
+void ScriptableComponent::SetUpdateRate(float hz)
+{
+    if (hz <= 0.0f)
+        SetUpdateEveryFrame();
+    else
+        SetUpdateFrequency(UpdateFrequency::Rate, 1, 1.0f / hz);
+}
+
+void ScriptableComponent::SetUpdateFrequency(UpdateFrequency frequency, uint32_t frames, float seconds)
+{
+    const bool wasBudgeted = frequency_ == UpdateFrequency::Budgeted;
+    frequency_ = frequency;
+    intervalFrames_ = std::max<uint32_t>(frames, 1);
+    intervalSeconds_ = seconds;
+
+    // Only budgeted scripts live in a separate list
+    GameObject* owner = GetOwner();
+    if (owner && wasBudgeted != (frequency == UpdateFrequency::Budgeted))
+        owner->OnUpdateFrequencyChanged(*this);
+}
+
+} // namespace Axion
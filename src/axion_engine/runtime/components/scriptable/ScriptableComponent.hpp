@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include "axion_engine/runtime/components/Component.hpp"
 
 #include "axion_engine/runtime/interfaces/IUpdateable.hpp"
@@ -8,12 +10,27 @@
 namespace Axion
 {
 
+/** @brief How often the scene updates a ScriptableComponent. */
+enum class UpdateFrequency : uint8_t
+{
+    EveryFrame,   ///< Every frame (default)
+    EveryNFrames, ///< Every N frames, instances staggered across frames
+    Rate,         ///< A number of times per second, instances staggered
+    Budgeted      ///< Round-robin after the regular updates, within the scene's script budget
+};
+
 /**
  * @brief Base class for custom game logic components.
- * 
+ *
  * ScriptableComponent combines Component, IUpdateable, and ICollisionListener
  * interfaces, providing a convenient base for game-specific behaviors.
- * 
+ *
+ * Scripts that do not need to run every frame can lower their update
+ * frequency (SetUpdateInterval(), SetUpdateRate(), SetUpdateBudgeted()).
+ * The frequency applies to Update() and IParallelUpdateable::ParallelUpdate();
+ * Start() and FixedUpdate() are unaffected. Such scripts should integrate
+ * with GetUpdateDeltaTime(), the time since their previous update.
+ *
  * @par Usage:
  * @code
  * class PlayerController : public Axion::ScriptableComponent {
@@ -21,11 +38,11 @@ namespace Axion
  *     void Start(Axion::EngineContext& ctx) override {
  *         // Initialize
  *     }
- *     
+ *
  *     void Update(Axion::EngineContext& ctx) override {
  *         // Per-frame logic
  *     }
- *     
+ *
  *     void OnCollisionEnter(Axion::GameObject& other) override {
  *         // Handle collision
  *     }
@@ -36,6 +53,78 @@ class ScriptableComponent : public Component, public IUpdateable, public ICollis
 {
 public:
     virtual ~ScriptableComponent() = default;
+
+    /** @brief Updates this script every frame (the default). */
+    void SetUpdateEveryFrame() { SetUpdateFrequency(UpdateFrequency::EveryFrame, 1, 0.0f); }
+
+    /**
+     * @brief Updates this script every @p frames frames.
+     *
+     * Instances get different frame offsets, so a crowd of scripts with the
+     * same interval is spread evenly over the frames.
+     */
+    void SetUpdateInterval(uint32_t frames);
+
+    /**
+     * @brief Updates this script @p hz times per second (0 for every frame).
+     *
+     * A script is updated on the first frame at least 1/hz seconds after its
+     * previous update; instances start at different offsets.
+     */
+    void SetUpdateRate(float hz);
+
+    /**
+     * @brief Updates this script only with the scene's spare script time.
+     *
+     * Budgeted scripts run after the regular updates, one after the other
+     * in round-robin order, until the scene's per-frame budget is spent
+     * (see Scene::SetScriptBudget()). At least one runs every frame.
+     *
+     * @note Main thread only (switching to or from this mode).
+     */
+    void SetUpdateBudgeted() { SetUpdateFrequency(UpdateFrequency::Budgeted, 1, 0.0f); }
+
+    /** @brief Returns how often this script is updated. */
+    UpdateFrequency GetUpdateFrequency() const { return frequency_; }
+
+    /**
+     * @brief Returns the seconds elapsed since this script's previous update.
+     *
+     * Equals the frame delta time for scripts updated every frame; use it
+     * instead of ITimeProvider::GetDeltaTime() in scripts that are not.
+     * The first update after registering or enabling reports the frame
+     * delta time.
+     */
+    float GetUpdateDeltaTime() const { return updateDelta_; }
+
+private:
+    friend class UpdateBuckets;
+    friend struct UpdateClock;
+
+    void SetUpdateFrequency(UpdateFrequency frequency, uint32_t frames, float seconds);
+
+    // Forgets the last update; the next one reports the frame delta
+    void ResetTiming()
+    {
+        lastUpdate_ = -1.0;
+        firstUpdate_ = -1.0;
+    }
+
+    // Records an update at the given script time
+    void Stamp(double time, float deltaTime)
+    {
+        updateDelta_ = lastUpdate_ < 0.0 ? deltaTime : static_cast<float>(time - lastUpdate_);
+        lastUpdate_ = time;
+    }
+
+    UpdateFrequency frequency_ = UpdateFrequency::EveryFrame;
+    uint32_t intervalFrames_ = 1;
+    float intervalSeconds_ = 0.0f;
+    uint32_t phase_ = 0;                 // Stagger offset, assigned on registration
+    uint32_t budgetIndex_ = UINT32_MAX;  // Slot in the scene's budgeted list
+    double lastUpdate_ = -1.0;           // Script time of the last update, < 0 before the first
+    double firstUpdate_ = -1.0;          // Script time the first Rate update is due, < 0 until scheduled
+    float updateDelta_ = 0.0f;
 };
 
-} // namespace Axion
\ No newline at end of file
+} // namespace Axion
@@ -1,34 +1,106 @@
 #pragma once
 
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
 #include "axion_engine/runtime/components/Component.hpp"
+#include "axion_engine/runtime/classes/serialization/ComponentArchive.hpp"
+#include "axion_engine/runtime/classes/snapshot/ComponentState.hpp"
+#include "Affine2D.hpp"
 
 namespace Axion
 {
 
+/** @brief How a transform builds its matrices. */
+enum class TransformMode
+{
+    Planar2D, ///< Z rotation only, cached sin/cos and 2x3 affine matrices
+    Full3D    ///< Full Euler rotation with 4x4 matrices
+};
+
 /**
  * @brief Component that stores position, rotation, and scale of a GameObject.
  * 
  * TransformComponent provides spatial information and transformation matrices
  * for positioning objects in the game world. Uses lazy evaluation for matrix
  * calculation to avoid unnecessary recomputation.
+ *
+ * Transforms can be parented (see GameObject::SetParent()). Local values are
+ * relative to the parent; world values are cached and only recomputed when
+ * this transform or one of its ancestors changed. Changing a transform marks
+ * its whole subtree dirty, and Scene resolves all dirty world matrices once
+ * per frame in a single breadth-first pass (see TransformHierarchy).
+ *
+ * By default transforms are planar (TransformMode::Planar2D): only the Z
+ * rotation is used, its sin/cos are cached, and local/world transforms are
+ * 2x3 affine matrices (see GetAffine2D() and GetWorldAffine2D()). The 4x4
+ * matrices are still available and are built lazily on request.
  */
 class TransformComponent : public Component
 {
+    friend class TransformHierarchy;
+
 public:
+    TransformComponent() = default;
+
+    /**
+     * @brief Copies the local position, rotation, scale and mode.
+     *
+     * The copy is a detached root: parent, children and cached matrices
+     * are not copied.
+     */
+    TransformComponent(const TransformComponent& other)
+        : Component(other),
+          position_(other.position_),
+          rotationEuler_(other.rotationEuler_),
+          scale_(other.scale_),
+          mode_(other.mode_)
+    {
+    }
+
+    TransformComponent& operator=(const TransformComponent&) = delete;
+
     /**
      * @brief Returns the local transformation matrix.
      * @return Combined translation, rotation, and scale matrix
      */
     glm::mat4 GetMatrix() const
     {
-        if (dirty_)
+        if (matrixDirty_)
             RecalculateMatrix();
         return matrix_;
     }
 
+    /**
+     * @brief Returns the local transform as a 2x3 affine matrix.
+     * @return Translation, Z rotation and scale in the XY plane
+     */
+    const Affine2D& GetAffine2D() const
+    {
+        if (dirty_)
+            RecalculateLocal();
+        return affine_;
+    }
+
+    /** @brief Returns the transform mode. */
+    TransformMode GetMode() const { return mode_; }
+
+    /**
+     * @brief Sets the transform mode.
+     * @param mode Planar2D (default) or Full3D for X/Y rotations
+     */
+    void SetMode(TransformMode mode)
+    {
+        if (mode_ == mode)
+            return;
+        mode_ = mode;
+        MarkDirty();
+    }
+
     /** @brief Returns the local position. */
     glm::vec3 GetPosition() const { return position_; }
     
@@ -39,7 +111,7 @@ public:
     void SetPosition(const glm::vec3& p)
     {
         position_ = p;
-        dirty_ = true;
+        MarkDirty();
     }
 
     /** @brief Returns the local rotation in degrees (Euler angles). */
@@ -52,7 +124,7 @@ public:
     void SetRotation(const glm::vec3& rDeg)
     {
         rotationEuler_ = rDeg;
-        dirty_ = true;
+        MarkDirty();
     }
 
     /** @brief Returns the local scale. */
@@ -65,7 +137,7 @@ public:
     void SetScale(const glm::vec3& s)
     {
         scale_ = s;
-        dirty_ = true;
+        MarkDirty();
     }
 
     /**
@@ -77,7 +149,7 @@ public:
     void Translate(float dx, float dy, float dz)
     {
         position_ += glm::vec3(dx, dy, dz);
-        dirty_ = true;
+        MarkDirty();
     }
 
     /**
@@ -91,12 +163,15 @@ public:
         rotationEuler_.x += pitchDeg;
         rotationEuler_.y += yawDeg;
         rotationEuler_.z += rollDeg;
-        dirty_ = true;
+        MarkDirty();
     }
 
     /** @brief Returns the forward direction vector (negative Z). */
     glm::vec3 GetForwardVector() const
     {
+        if (mode_ == TransformMode::Planar2D)
+            return {0.0f, 0.0f, -1.0f};
+
         glm::mat4 rotationMatrix = GetRotationMatrix();
         glm::vec4 forward = rotationMatrix * glm::vec4(0, 0, -1, 0);
         return glm::normalize(glm::vec3(forward));
@@ -105,6 +180,13 @@ public:
     /** @brief Returns the up direction vector (positive Y). */
     glm::vec3 GetUpVector() const
     {
+        if (mode_ == TransformMode::Planar2D)
+        {
+            if (dirty_)
+                RecalculateLocal();
+            return {-sin_, cos_, 0.0f};
+        }
+
         glm::mat4 rotationMatrix = GetRotationMatrix();
         glm::vec4 up = rotationMatrix * glm::vec4(0, 1, 0, 0);
         return glm::normalize(glm::vec3(up));
@@ -113,6 +195,13 @@ public:
     /** @brief Returns the right direction vector (positive X). */
     glm::vec3 GetRightVector() const
     {
+        if (mode_ == TransformMode::Planar2D)
+        {
+            if (dirty_)
+                RecalculateLocal();
+            return {cos_, sin_, 0.0f};
+        }
+
         glm::mat4 rotationMatrix = GetRotationMatrix();
         glm::vec4 right = rotationMatrix * glm::vec4(1, 0, 0, 0);
         return glm::normalize(glm::vec3(right));
@@ -128,28 +217,256 @@ public:
         return r;
     }
 
-    /** @brief Returns the world transformation matrix. */
-    glm::mat4 GetWorldMatrix() const { return GetMatrix(); }
-    
-    /** @brief Returns the world position. */
-    glm::vec3 GetWorldPosition() const { return position_; }
-    
-    /** @brief Returns the world rotation. */
-    glm::vec3 GetWorldRotation() const { return rotationEuler_; }
-    
-    /** @brief Returns the world scale. */
-    glm::vec3 GetWorldScale() const { return scale_; }
+    /** @brief Returns the world transformation matrix (parent chain applied). */
+    glm::mat4 GetWorldMatrix() const
+    {
+        if (worldMatrixDirty_)
+        {
+            worldMatrix_ = parent_ ? parent_->GetWorldMatrix() * GetMatrix() : GetMatrix();
+            worldMatrixDirty_ = false;
+        }
+        return worldMatrix_;
+    }
+
+    /** @brief Returns the world transform as a 2x3 affine matrix. */
+    const Affine2D& GetWorldAffine2D() const
+    {
+        ResolveWorld();
+        return worldAffine_;
+    }
+
+    /**
+     * @brief Returns the world position.
+     * @note World Z is the sum of local Z values along the parent chain.
+     */
+    glm::vec3 GetWorldPosition() const
+    {
+        if (!parent_)
+            return position_;
+        ResolveWorld();
+        return {worldAffine_.tx, worldAffine_.ty, worldZ_};
+    }
+
+    /**
+     * @brief Returns the world rotation.
+     * @note Euler angles are accumulated along the parent chain, which is
+     *       exact for rotations around Z (the only axis used in 2D).
+     */
+    glm::vec3 GetWorldRotation() const
+    {
+        if (!parent_)
+            return rotationEuler_;
+        ResolveWorld();
+        return worldRotation_;
+    }
+
+    /** @brief Returns the world scale (component-wise product along the parent chain). */
+    glm::vec3 GetWorldScale() const
+    {
+        if (!parent_)
+            return scale_;
+        ResolveWorld();
+        return worldScale_;
+    }
+
+    /** @brief Returns the parent transform, or nullptr for a root. */
+    TransformComponent* GetParent() const { return parent_; }
+
+    /** @brief Returns the direct child transforms. */
+    const std::vector<TransformComponent*>& GetChildren() const { return children_; }
+
+    /**
+     * @brief Re-parents this transform. Local values are kept as-is.
+     * @param parent New parent, or nullptr to make this a root
+     * @note Use GameObject::SetParent() so the scene hierarchy is updated.
+     */
+    void SetParent(TransformComponent* parent)
+    {
+        if (parent == parent_ || parent == this)
+            return;
+
+        if (parent_)
+        {
+            auto& siblings = parent_->children_;
+            siblings.erase(std::remove(siblings.begin(), siblings.end(), this), siblings.end());
+        }
+
+        parent_ = parent;
+        if (parent_)
+            parent_->children_.push_back(this);
+
+        MarkWorldDirty();
+    }
+
+    /** @brief Returns true if @p other is this transform or one of its ancestors. */
+    bool IsDescendantOf(const TransformComponent* other) const
+    {
+        for (const TransformComponent* t = this; t; t = t->parent_)
+        {
+            if (t == other)
+                return true;
+        }
+        return false;
+    }
+
+    /** @brief Writes the local position, rotation, scale and mode. */
+    void Serialize(ComponentWriter& writer) const override
+    {
+        writer.Write(position_);
+        writer.Write(rotationEuler_);
+        writer.Write(scale_);
+        writer.Write(mode_);
+    }
+
+    /** @brief Reads the local position, rotation, scale and mode. */
+    void Deserialize(ComponentReader& reader) override
+    {
+        reader.Read(position_);
+        reader.Read(rotationEuler_);
+        reader.Read(scale_);
+        reader.Read(mode_);
+        MarkDirty();
+    }
+
+    void SaveState(StateWriter& writer) const override
+    {
+        writer.Write(position_);
+        writer.Write(rotationEuler_);
+        writer.Write(scale_);
+    }
+
+    void LoadState(StateReader& reader) override
+    {
+        reader.Read(position_);
+        reader.Read(rotationEuler_);
+        reader.Read(scale_);
+        MarkDirty();
+    }
 
 private:
     glm::vec3 position_{0.0f};
     glm::vec3 rotationEuler_{0.0f};
     glm::vec3 scale_{1.0f};
+    TransformMode mode_ = TransformMode::Planar2D;
 
-    mutable glm::mat4 matrix_{1.0f};
+    // Local state: affine + cached sin/cos, and the lazily built 4x4 matrix
+    mutable Affine2D affine_;
+    mutable float sin_ = 0.0f;
+    mutable float cos_ = 1.0f;
     mutable bool dirty_{true};
 
+    mutable glm::mat4 matrix_{1.0f};
+    mutable bool matrixDirty_{true};
+
+    // World state, resolved by TransformHierarchy or lazily on access
+    mutable Affine2D worldAffine_;
+    mutable float worldZ_ = 0.0f;
+    mutable glm::vec3 worldRotation_{0.0f};
+    mutable glm::vec3 worldScale_{1.0f};
+    mutable bool worldDirty_{true};
+
+    mutable glm::mat4 worldMatrix_{1.0f};
+    mutable bool worldMatrixDirty_{true};
+
+    // Set by every world change; unlike worldDirty_ only TransformHierarchy::Update() clears it,
+    // so lazy reads cannot hide a move from the scene's spatial index and render queue
+    bool movedSinceUpdate_{true};
+
+    TransformComponent* parent_ = nullptr;
+    std::vector<TransformComponent*> children_;
+
+    void MarkDirty()
+    {
+        dirty_ = true;
+        matrixDirty_ = true;
+        MarkWorldDirty();
+    }
+
+    void MarkWorldDirty()
+    {
+        // A subtree that is already dirty has all of its descendants dirty too
+        if (worldDirty_ && worldMatrixDirty_ && movedSinceUpdate_)
+            return;
+        worldDirty_ = true;
+        worldMatrixDirty_ = true;
+        movedSinceUpdate_ = true;
+        for (TransformComponent* child : children_)
+            child->MarkWorldDirty();
+    }
+
+    void ResolveWorld() const
+    {
+        if (!worldDirty_)
+            return;
+        if (parent_)
+            parent_->ResolveWorld();
+        UpdateWorld();
+    }
+
+    // Recomputes the world state; the parent must already be resolved
+    void UpdateWorld() const
+    {
+        if (mode_ == TransformMode::Full3D)
+        {
+            // X/Y rotations do not compose as 2D affines; project the 4x4 instead
+            const glm::mat4 world = GetWorldMatrix();
+            worldAffine_ = Affine2D::FromMat4(world);
+            worldZ_ = world[3][2];
+        }
+        else if (parent_)
+        {
+            worldAffine_ = parent_->worldAffine_ * GetAffine2D();
+            worldZ_ = parent_->worldZ_ + position_.z;
+        }
+        else
+        {
+            worldAffine_ = GetAffine2D();
+            worldZ_ = position_.z;
+        }
+
+        if (parent_)
+        {
+            worldRotation_ = parent_->worldRotation_ + rotationEuler_;
+            worldScale_ = parent_->worldScale_ * scale_;
+        }
+        else
+        {
+            worldRotation_ = rotationEuler_;
+            worldScale_ = scale_;
+        }
+        worldDirty_ = false;
+    }
+
+    void RecalculateLocal() const
+    {
+        const float rad = glm::radians(rotationEuler_.z);
+        sin_ = std::sin(rad);
+        cos_ = std::cos(rad);
+
+        if (mode_ == TransformMode::Full3D)
+            affine_ = Affine2D::FromMat4(GetMatrix());
+        else
+            affine_ = Affine2D::FromTRS({position_.x, position_.y}, sin_, cos_, {scale_.x, scale_.y});
+        dirty_ = false;
+    }
+
     void RecalculateMatrix() const
     {
+        if (mode_ == TransformMode::Planar2D)
+        {
+            const Affine2D& a = GetAffine2D();
+            glm::mat4 m(1.0f);
+            m[0][0] = a.a;
+            m[0][1] = a.b;
+            m[1][0] = a.c;
+            m[1][1] = a.d;
+            m[2][2] = scale_.z;
+            m[3] = glm::vec4(a.tx, a.ty, position_.z, 1.0f);
+            matrix_ = m;
+            matrixDirty_ = false;
+            return;
+        }
+
         glm::mat4 m(1.0f);
         m = glm::translate(m, position_);
         m = glm::rotate(m, glm::radians(rotationEuler_.x), glm::vec3(1, 0, 0));
@@ -157,8 +474,8 @@ private:
         m = glm::rotate(m, glm::radians(rotationEuler_.z), glm::vec3(0, 0, 1));
         m = glm::scale(m, scale_);
         matrix_ = m;
-        dirty_ = false;
+        matrixDirty_ = false;
     }
 };
 
-} // namespace Axion
\ No newline at end of file
+} // namespace Axion
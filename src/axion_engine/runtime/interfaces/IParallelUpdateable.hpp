@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <typeindex>
+#include <vector>
+
+#include "axion_engine/core/EngineContext.hpp"
+
+namespace Axion
+{
+
+/**
+ * @brief Component types a parallel update reads and writes.
+ *
+ * - Reads<T>(): may read T on any GameObject.
+ * - Writes<T>(): may write T, but only on the owning GameObject.
+ *
+ * Two systems whose sets overlap on a written type never run at the same
+ * time. Instances of one system always run concurrently with each other,
+ * unless the system is marked Exclusive().
+ */
+class AccessSet
+{
+public:
+    /** @brief Declares read access to component type T. */
+    template <typename T>
+    AccessSet& Reads()
+    {
+        Add(reads_, std::type_index(typeid(T)));
+        return *this;
+    }
+
+    /** @brief Declares owner-local write access to component type T. */
+    template <typename T>
+    AccessSet& Writes()
+    {
+        Add(writes_, std::type_index(typeid(T)));
+        return *this;
+    }
+
+    /**
+     * @brief Runs all instances of this system on one thread.
+     *
+     * Use when instances touch each other's data (for example a component
+     * that reads the transforms of other objects of its own type).
+     */
+    AccessSet& Exclusive()
+    {
+        exclusive_ = true;
+        return *this;
+    }
+
+    /** @brief Adds a written type by index (used by the scheduler). */
+    void AddWrite(std::type_index type) { Add(writes_, type); }
+
+    /** @brief Returns true if the two sets cannot run concurrently. */
+    bool ConflictsWith(const AccessSet& other) const
+    {
+        for (const auto& w : writes_)
+        {
+            if (Contains(other.reads_, w) || Contains(other.writes_, w))
+                return true;
+        }
+        for (const auto& w : other.writes_)
+        {
+            if (Contains(reads_, w))
+                return true;
+        }
+        return false;
+    }
+
+    bool IsExclusive() const { return exclusive_; }
+    const std::vector<std::type_index>& GetReads() const { return reads_; }
+    const std::vector<std::type_index>& GetWrites() const { return writes_; }
+
+private:
+    static bool Contains(const std::vector<std::type_index>& set, std::type_index type)
+    {
+        return std::find(set.begin(), set.end(), type) != set.end();
+    }
+
+    static void Add(std::vector<std::type_index>& set, std::type_index type)
+    {
+        if (!Contains(set, type))
+            set.push_back(type);
+    }
+
+    std::vector<std::type_index> reads_;
+    std::vector<std::type_index> writes_;
+    bool exclusive_ = false;
+};
+
+/**
+ * @brief Interface for components updated on worker threads.
+ *
+ * All components of one concrete type form a "system". Each frame the
+ * scene's UpdateScheduler groups systems whose declared accesses do not
+ * conflict into batches and runs every batch across the job system, after
+ * the serial IUpdateable::Update pass. Start() is still called on the main
+ * thread.
+ *
+ * @par Usage:
+ * @code
+ * class Boid : public ScriptableComponent, public IParallelUpdateable {
+ * public:
+ *     void DeclareAccess(AccessSet& access) const override {
+ *         access.Reads<TransformComponent>().Writes<TransformComponent>();
+ *     }
+ *     void ParallelUpdate(EngineContext& ctx) override { ... }
+ * };
+ * @endcode
+ *
+ * @note CreateGameObject() and Destroy() are safe to call from
+ *       ParallelUpdate(); they are deferred to the main thread. Anything
+ *       else outside the declared accesses (events, logging, assets) is not.
+ */
+class IParallelUpdateable
+{
+public:
+    virtual ~IParallelUpdateable() = default;
+
+    /**
+     * @brief Declares the component types this update touches.
+     * @param access Set to fill; the component's own type is added as written
+     */
+    virtual void DeclareAccess(AccessSet& access) const = 0;
+
+    /** @brief Called every frame on a worker thread. */
+    virtual void ParallelUpdate(EngineContext& context) = 0;
+};
+
+} // namespace Axion
@@ -1,19 +1,60 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <glm/glm.hpp>
 #include "axion_engine/runtime/components/camera/CameraComponent.hpp"
+#include "axion_engine/runtime/components/transform/Affine2D.hpp"
+#include "axion_engine/managers/render/RenderCommandList.hpp"
 
 namespace Axion
 {
 
 /**
  * @brief Context passed to renderable components during rendering.
+ *
+ * The view fields are computed once per frame by SetView(), so renderables
+ * map world positions to pixels without querying the renderer or the camera.
+ * There is deliberately no renderer: renderables record into @c commands,
+ * possibly on a worker thread.
  */
 struct RenderContext
 {
-    SDL_Renderer* renderer = nullptr;
     CameraComponent* camera = nullptr;
     int windowWidth = 0;
     int windowHeight = 0;
+    glm::vec2 cameraPosition{0.0f}; ///< Camera world position (X/Y)
+    float zoom = 1.0f;              ///< Pixels per world unit
+    glm::vec2 screenCenter{0.0f};   ///< Center of the output in pixels
+    Affine2D worldToScreen;         ///< World (Y up) to screen pixels (Y down)
+    glm::vec2 viewMin{0.0f};        ///< Lower corner of the world rectangle on screen
+    glm::vec2 viewMax{0.0f};        ///< Upper corner of the world rectangle on screen
+    RenderCommandList* commands = nullptr; ///< Command list being recorded
+
+    /**
+     * @brief Computes the view fields for a frame.
+     * @param camPos Camera world position
+     * @param pixelsPerUnit Zoom factor
+     * @param width Output width in pixels
+     * @param height Output height in pixels
+     */
+    void SetView(const glm::vec2& camPos, float pixelsPerUnit, int width, int height)
+    {
+        windowWidth = width;
+        windowHeight = height;
+        cameraPosition = camPos;
+        zoom = pixelsPerUnit;
+        screenCenter = glm::vec2(width * 0.5f, height * 0.5f);
+        worldToScreen = {zoom, 0.0f, 0.0f, -zoom, screenCenter.x - camPos.x * zoom, screenCenter.y + camPos.y * zoom};
+
+        const glm::vec2 halfView = screenCenter / zoom;
+        viewMin = camPos - halfView;
+        viewMax = camPos + halfView;
+    }
+
+    /** @brief Maps a world point to screen pixels, flipping Y (sprites, circles). */
+    glm::vec2 WorldToScreen(const glm::vec2& p) const { return worldToScreen.TransformPoint(p); }
+
+    /** @brief Maps a world point to screen pixels without flipping Y (squares, text, AABB gizmos). */
+    glm::vec2 WorldToScreenUnflipped(const glm::vec2& p) const { return (p - cameraPosition) * zoom + screenCenter; }
 };
 
 /**
@@ -48,8 +89,41 @@ public:
     virtual int GetOrderInLayer() const = 0;
 
     /**
-     * @brief Renders the component.
-     * @param ctx Rendering context with renderer and camera info
+     * @brief Returns the texture this renderable batches with, if any.
+     *
+     * Renderables with the same layer and order are grouped by it, so
+     * sprites sharing a texture end up in the same batch.
+     */
+    virtual SDL_Texture* GetBatchTexture() const { return nullptr; }
+
+    /**
+     * @brief Returns the world-space box this renderable draws into, for culling.
+     * @return False if unknown; such renderables are never culled
+     */
+    virtual bool GetWorldBounds(glm::vec2& min, glm::vec2& max) const { return false; }
+
+    /**
+     * @brief Returns true if this renderable is baked into the static layer.
+     *
+     * Static renderables with world bounds are drawn once into cached chunk
+     * textures and redrawn only when their key or bounds change (see
+     * RenderManager); they appear under the other renderables of their layer.
+     */
+    virtual bool IsStatic() const { return false; }
+
+    /**
+     * @brief Creates or updates the resources Render() needs.
+     *
+     * Called on the main thread every frame the renderable is visible,
+     * before Render(), also when there is no renderer (headless NoRender).
+     * Only renderables that build resources (text layout) need it.
+     */
+    virtual void PrepareRender(EngineContext& context) {}
+
+    /**
+     * @brief Records the component's draw commands into ctx.commands.
+     * @param ctx Rendering context with the view and the command list
+     * @note May run on a worker thread: must not call SDL or modify the scene.
      */
     virtual void Render(const RenderContext& ctx) = 0;
 };
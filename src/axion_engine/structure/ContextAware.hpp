@@ -2,6 +2,7 @@
 
 #include "axion_engine/core/EngineContext.hpp"
 #include "axion_engine/managers/logger/Logger.hpp"
+#include "axion_engine/core/jobs/JobSystem.hpp"
 
 namespace Axion
 {
@@ -39,7 +40,9 @@ protected:
     SceneManager& scene() const noexcept { return *ctx_.scene; }
     PhysicsManager& physics() const noexcept { return *ctx_.physics; }
     AssetsManager& assets() const noexcept { return *ctx_.assets; }
+    FontManager& fonts() const noexcept { return *ctx_.fonts; }
     Logger& logger() const noexcept { return *ctx_.logger; }
+    JobSystem& jobs() const noexcept { return *ctx_.jobs; }
 };
 
 } // namespace Axion
\ No newline at end of file
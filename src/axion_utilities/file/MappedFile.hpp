@@ -0,0 +1,142 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Axion
+{
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The file's pages are mapped into the address space instead of being read
+ * into a buffer: data is paged in by the OS on first access and never
+ * copied. The mapping is released with the object.
+ *
+ * @par Usage:
+ * @code
+ * MappedFile file;
+ * if (file.Open(path))
+ *     Parse(file.GetData(), file.GetSize());
+ * @endcode
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file, closing any previous mapping.
+     * @param path Path of the file
+     * @return True on success; empty files fail
+     */
+    bool Open(const std::string& path)
+    {
+        Close();
+
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0)
+        {
+            Close();
+            return false;
+        }
+
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_)
+        {
+            Close();
+            return false;
+        }
+
+        data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        if (!data_)
+        {
+            Close();
+            return false;
+        }
+        size_ = static_cast<size_t>(size.QuadPart);
+#else
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // The mapping keeps its own reference to the file
+        if (data == MAP_FAILED)
+            return false;
+
+        data_ = static_cast<const uint8_t*>(data);
+        size_ = static_cast<size_t>(info.st_size);
+#endif
+        return true;
+    }
+
+    /** @brief Unmaps the file. */
+    void Close()
+    {
+#ifdef _WIN32
+        if (data_)
+            UnmapViewOfFile(data_);
+        if (mapping_)
+            CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE)
+            CloseHandle(file_);
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if (data_)
+            munmap(const_cast<uint8_t*>(data_), size_);
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    /** @brief Returns true while a file is mapped. */
+    bool IsOpen() const { return data_ != nullptr; }
+
+    /** @brief Returns the first byte of the file (page aligned), or nullptr. */
+    const uint8_t* GetData() const { return data_; }
+
+    /** @brief Returns the size of the file in bytes. */
+    size_t GetSize() const { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#endif
+};
+
+} // namespace Axion
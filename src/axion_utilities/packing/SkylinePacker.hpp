@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+namespace Axion
+{
+
+/** @brief Position of a rectangle placed by SkylinePacker. */
+struct PackedRect
+{
+    int x = 0;
+    int y = 0;
+    int w = 0;
+    int h = 0;
+};
+
+/**
+ * @brief Packs rectangles into a fixed-size area (skyline bottom-left).
+ *
+ * The packer keeps the top outline of everything placed so far as a list of
+ * horizontal segments and puts each new rectangle where its top edge ends up
+ * lowest. Inserting rectangles sorted by decreasing height gives tight
+ * packings for typical sprite sets.
+ *
+ * @par Usage:
+ * @code
+ * SkylinePacker packer(2048, 2048);
+ * PackedRect rect;
+ * if (!packer.Insert(64, 32, rect))
+ *     // Page full, start another one
+ * @endcode
+ */
+class SkylinePacker
+{
+public:
+    SkylinePacker(int width = 0, int height = 0) { Reset(width, height); }
+
+    /** @brief Empties the packer and changes its size. */
+    void Reset(int width, int height)
+    {
+        width_ = width;
+        height_ = height;
+        usedArea_ = 0;
+        skyline_.assign(1, Segment{0, 0, width});
+    }
+
+    /**
+     * @brief Places a rectangle.
+     * @param out Receives the position on success
+     * @return False if the rectangle does not fit anywhere
+     */
+    bool Insert(int w, int h, PackedRect& out)
+    {
+        if (w <= 0 || h <= 0)
+            return false;
+
+        size_t bestIndex = skyline_.size();
+        int bestTop = INT_MAX;
+        int bestWidth = INT_MAX;
+        for (size_t i = 0; i < skyline_.size(); ++i)
+        {
+            int y = 0;
+            if (!Fits(i, w, h, y))
+                continue;
+
+            // Lowest top edge, then the narrowest segment to waste the least
+            if (y + h < bestTop || (y + h == bestTop && skyline_[i].width < bestWidth))
+            {
+                bestIndex = i;
+                bestTop = y + h;
+                bestWidth = skyline_[i].width;
+            }
+        }
+        if (bestIndex == skyline_.size())
+            return false;
+
+        out = {skyline_[bestIndex].x, bestTop - h, w, h};
+        Place(bestIndex, out);
+        usedArea_ += static_cast<size_t>(w) * static_cast<size_t>(h);
+        return true;
+    }
+
+    /** @brief Returns the fraction of the area covered by placed rectangles. */
+    float GetOccupancy() const
+    {
+        const size_t area = static_cast<size_t>(width_) * static_cast<size_t>(height_);
+        return area > 0 ? static_cast<float>(usedArea_) / static_cast<float>(area) : 0.0f;
+    }
+
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+
+private:
+    struct Segment
+    {
+        int x;
+        int y;
+        int width;
+    };
+
+    // Finds the height a rectangle would rest at with its left edge on segment @p index
+    bool Fits(size_t index, int w, int h, int& y) const
+    {
+        const int x = skyline_[index].x;
+        if (x + w > width_)
+            return false;
+
+        y = 0;
+        int remaining = w;
+        for (size_t i = index; remaining > 0; ++i)
+        {
+            if (i == skyline_.size())
+                return false;
+            y = std::max(y, skyline_[i].y);
+            if (y + h > height_)
+                return false;
+            remaining -= skyline_[i].width;
+        }
+        return true;
+    }
+
+    void Place(size_t index, const PackedRect& rect)
+    {
+        skyline_.insert(skyline_.begin() + static_cast<std::ptrdiff_t>(index), Segment{rect.x, rect.y + rect.h, rect.w});
+
+        // Cut the segments now covered by the new one
+        for (size_t i = index + 1; i < skyline_.size();)
+        {
+            const Segment& previous = skyline_[i - 1];
+            Segment& segment = skyline_[i];
+            const int overlap = previous.x + previous.width - segment.x;
+            if (overlap <= 0)
+                break;
+
+            segment.x += overlap;
+            segment.width -= overlap;
+            if (segment.width > 0)
+                break;
+            skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+
+        // Merge neighbours at the same height
+        for (size_t i = 0; i + 1 < skyline_.size();)
+        {
+            if (skyline_[i].y == skyline_[i + 1].y)
+            {
+                skyline_[i].width += skyline_[i + 1].width;
+                skyline_.erase(skyline_.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    int width_ = 0;
+    int height_ = 0;
+    size_t usedArea_ = 0;
+    std::vector<Segment> skyline_;
+};
+
+} // namespace Axion
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+namespace Axion
+{
+
+/** @brief Handle value of an item that is not in a LooseQuadtree. */
+constexpr uint32_t InvalidQuadtreeHandle = UINT32_MAX;
+
+/**
+ * @brief Loose quadtree of axis-aligned boxes.
+ *
+ * Each item lives in exactly one node: the deepest one whose cell contains
+ * the item's center and whose loose bounds (the cell grown to twice its
+ * size) contain the whole box. Placement therefore only depends on the
+ * center and the size of a box, so moving an item is a short descent and
+ * usually ends in the node it already was in.
+ *
+ * Nodes are created on demand and kept (with a count of the items below
+ * them, so queries skip empty subtrees). Items outside the root cell stay in
+ * the root, which every query visits.
+ *
+ * Queries are read-only and may run concurrently; Insert(), Update() and
+ * Remove() must not run at the same time as anything else.
+ *
+ * @tparam T Item payload, copied into the tree (usually a pointer)
+ */
+template <typename T>
+class LooseQuadtree
+{
+public:
+    using Handle = uint32_t;
+
+    /**
+     * @param center Center of the root cell
+     * @param halfSize Half the side of the root cell
+     * @param maxDepth Levels below the root (at most 15)
+     */
+    explicit LooseQuadtree(const glm::vec2& center = glm::vec2(0.0f), float halfSize = 8192.0f, uint32_t maxDepth = 8)
+    {
+        Reset(center, halfSize, maxDepth);
+    }
+
+    /** @brief Changes the root cell and removes every item. */
+    void Reset(const glm::vec2& center, float halfSize, uint32_t maxDepth)
+    {
+        center_ = center;
+        halfSize_ = std::max(halfSize, 1.0f);
+        maxDepth_ = std::min<uint32_t>(maxDepth, 15);
+        Clear();
+    }
+
+    /** @brief Removes every item; handles given out so far become invalid. */
+    void Clear()
+    {
+        nodes_.clear();
+        nodes_.push_back(Node{center_, halfSize_});
+        items_.clear();
+        freeItems_.clear();
+    }
+
+    /**
+     * @brief Adds an item.
+     * @return Handle for Update() and Remove()
+     */
+    Handle Insert(const T& value, const glm::vec2& min, const glm::vec2& max)
+    {
+        Handle handle;
+        if (!freeItems_.empty())
+        {
+            handle = freeItems_.back();
+            freeItems_.pop_back();
+        }
+        else
+        {
+            handle = static_cast<Handle>(items_.size());
+            items_.emplace_back();
+        }
+
+        Item& item = items_[handle];
+        item.value = value;
+        item.min = min;
+        item.max = max;
+        Link(handle, FindNode(min, max));
+        return handle;
+    }
+
+    /** @brief Moves or resizes an item. */
+    void Update(Handle handle, const glm::vec2& min, const glm::vec2& max)
+    {
+        Item& item = items_[handle];
+        item.min = min;
+        item.max = max;
+
+        const uint32_t node = FindNode(min, max);
+        if (node != items_[handle].node)
+        {
+            Unlink(handle);
+            Link(handle, node);
+        }
+    }
+
+    /** @brief Removes an item; its handle may be given out again. */
+    void Remove(Handle handle)
+    {
+        Unlink(handle);
+        items_[handle].value = T{};
+        freeItems_.push_back(handle);
+    }
+
+    /**
+     * @brief Visits every item whose box overlaps a rectangle.
+     * @param visit Called as visit(const T&, const glm::vec2& min, const glm::vec2& max)
+     */
+    template <typename Visitor>
+    void Query(const glm::vec2& min, const glm::vec2& max, Visitor&& visit) const
+    {
+        Walk(min, max,
+             [&](const Item& item)
+             {
+                 if (item.min.x <= max.x && item.max.x >= min.x && item.min.y <= max.y && item.max.y >= min.y)
+                     visit(item.value, item.min, item.max);
+             });
+    }
+
+    /**
+     * @brief Visits every item whose box overlaps a circle.
+     * @param visit Called as visit(const T&, const glm::vec2& min, const glm::vec2& max)
+     */
+    template <typename Visitor>
+    void QueryRadius(const glm::vec2& center, float radius, Visitor&& visit) const
+    {
+        const float radiusSq = radius * radius;
+        Walk(center - glm::vec2(radius), center + glm::vec2(radius),
+             [&](const Item& item)
+             {
+                 const glm::vec2 offset = glm::clamp(center, item.min, item.max) - center;
+                 if (offset.x * offset.x + offset.y * offset.y <= radiusSq)
+                     visit(item.value, item.min, item.max);
+             });
+    }
+
+    /** @brief Returns the number of items. */
+    size_t GetCount() const { return nodes_.front().count; }
+
+    /** @brief Returns the number of nodes created so far. */
+    size_t GetNodeCount() const { return nodes_.size(); }
+
+    /** @brief Returns the center of the root cell. */
+    const glm::vec2& GetCenter() const { return center_; }
+
+    /** @brief Returns half the side of the root cell. */
+    float GetHalfSize() const { return halfSize_; }
+
+private:
+    struct Node
+    {
+        glm::vec2 center;
+        float halfSize;
+        uint32_t parent = 0;
+        uint32_t firstChild = 0; // 0 while not subdivided (the root is never a child)
+        uint32_t count = 0;      // Items in this node and below
+        std::vector<Handle> items;
+    };
+
+    struct Item
+    {
+        T value{};
+        glm::vec2 min{0.0f};
+        glm::vec2 max{0.0f};
+        uint32_t node = 0;
+        uint32_t slot = 0; // Position in the node's item list
+    };
+
+    uint32_t FindNode(const glm::vec2& min, const glm::vec2& max)
+    {
+        const glm::vec2 center = (min + max) * 0.5f;
+        const float extent = std::max(max.x - min.x, max.y - min.y) * 0.5f;
+
+        if (std::abs(center.x - center_.x) > halfSize_ || std::abs(center.y - center_.y) > halfSize_)
+            return 0;
+
+        // The center lies in the child's cell, so the box fits the child's
+        // loose bounds as long as its half extent is within the child's half size
+        uint32_t index = 0;
+        for (uint32_t depth = 0; depth < maxDepth_; ++depth)
+        {
+            if (extent > nodes_[index].halfSize * 0.5f)
+                break;
+            if (nodes_[index].firstChild == 0)
+                Subdivide(index);
+
+            const Node& node = nodes_[index];
+            const uint32_t quadrant = (center.x >= node.center.x ? 1u : 0u) | (center.y >= node.center.y ? 2u : 0u);
+            index = node.firstChild + quadrant;
+        }
+        return index;
+    }
+
+    void Subdivide(uint32_t index)
+    {
+        const auto first = static_cast<uint32_t>(nodes_.size());
+        const glm::vec2 center = nodes_[index].center;
+        const float half = nodes_[index].halfSize * 0.5f;
+        for (uint32_t quadrant = 0; quadrant < 4; ++quadrant)
+        {
+            Node child{center + glm::vec2(quadrant & 1u ? half : -half, quadrant & 2u ? half : -half), half};
+            child.parent = index;
+            nodes_.push_back(std::move(child));
+        }
+        nodes_[index].firstChild = first;
+    }
+
+    void Link(Handle handle, uint32_t index)
+    {
+        Item& item = items_[handle];
+        item.node = index;
+        item.slot = static_cast<uint32_t>(nodes_[index].items.size());
+        nodes_[index].items.push_back(handle);
+
+        for (uint32_t n = index;; n = nodes_[n].parent)
+        {
+            ++nodes_[n].count;
+            if (n == 0)
+                break;
+        }
+    }
+
+    void Unlink(Handle handle)
+    {
+        const Item& item = items_[handle];
+        auto& list = nodes_[item.node].items;
+        const Handle moved = list.back();
+        list[item.slot] = moved;
+        items_[moved].slot = item.slot;
+        list.pop_back();
+
+        for (uint32_t n = item.node;; n = nodes_[n].parent)
+        {
+            --nodes_[n].count;
+            if (n == 0)
+                break;
+        }
+    }
+
+    template <typename Test>
+    void Walk(const glm::vec2& min, const glm::vec2& max, Test&& test) const
+    {
+        // Depth-first; at most three siblings wait per level
+        std::array<uint32_t, 4 + 3 * 15> stack;
+        size_t top = 0;
+        stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const Node& node = nodes_[stack[--top]];
+            if (node.count == 0)
+                continue;
+
+            // The root also holds whatever lies outside it, so it is always searched
+            if (&node != &nodes_.front())
+            {
+                const float loose = node.halfSize * 2.0f;
+                if (node.center.x - loose > max.x || node.center.x + loose < min.x ||
+                    node.center.y - loose > max.y || node.center.y + loose < min.y)
+                    continue;
+            }
+
+            for (Handle handle : node.items)
+                test(items_[handle]);
+
+            if (node.firstChild != 0)
+            {
+                for (uint32_t quadrant = 0; quadrant < 4; ++quadrant)
+                    stack[top++] = node.firstChild + quadrant;
+            }
+        }
+    }
+
+    glm::vec2 center_{0.0f};
+    float halfSize_ = 0.0f;
+    uint32_t maxDepth_ = 0;
+
+    std::vector<Node> nodes_;
+    std::vector<Item> items_;
+    std::vector<Handle> freeItems_;
+};
+
+} // namespace Axion
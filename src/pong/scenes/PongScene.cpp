@@ -9,11 +9,10 @@ void PongScene::OnSceneEnter()
 {
     printf("Entered Pong Scene - WASD to move, AI opponent!\n");
 
-    int windowWidth, windowHeight;
-    SDL_GetWindowSize(GetContext().window->GetSDLWindow(), &windowWidth, &windowHeight);
+    const glm::ivec2 windowSize = GetContext().window->GetSize();
 
-    const float screenWidth = static_cast<float>(windowWidth);
-    const float screenHeight = static_cast<float>(windowHeight);
+    const float screenWidth = static_cast<float>(windowSize.x);
+    const float screenHeight = static_cast<float>(windowSize.y);
 
     const float paddleWidth = screenWidth * 0.02f;
     const float paddleHeight = screenHeight * 0.15f;
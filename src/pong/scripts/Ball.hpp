@@ -97,6 +97,16 @@ public:
         velocity = glm::vec2(0.0f, 0.0f);
     }
 
+    void SaveState(StateWriter& writer) const override
+    {
+        writer.Write(velocity);
+    }
+
+    void LoadState(StateReader& reader) override
+    {
+        reader.Read(velocity);
+    }
+
     void SetOnPlayer1Score(std::function<void()> callback) { onPlayer1Score = callback; }
     void SetOnPlayer2Score(std::function<void()> callback) { onPlayer2Score = callback; }
 
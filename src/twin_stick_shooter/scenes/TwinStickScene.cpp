@@ -1,9 +1,18 @@
 #include "TwinStickScene.hpp"
-#include "../scripts/InfiniteBackgroundScript.hpp"
 
 namespace Axion
 {
 
+void TwinStickScene::OnScenePreload()
+{
+    PreloadTexture("Background", "background.png");
+
+    // Characters and crosshair share one atlas page, so they draw in a single batch
+    PreloadAtlasImage("Characters", "PlayerSprite", "survivor_pistol.png");
+    PreloadAtlasImage("Characters", "Crosshair", "Reticle-66.png");
+    PreloadAtlasImage("Characters", "ZombieSprite", "zombie.png");
+}
+
 void TwinStickScene::OnSceneEnter()
 {
     // Reset game state
@@ -13,38 +22,38 @@ void TwinStickScene::OnSceneEnter()
     zombiesKilledThisRound = 0;
     zombiesSpawnedThisRound = 0;
     zombieSpawnTimer = 0.0f;
+
+    CreatePrefabs();
+    bulletPool = CreatePool(bulletPrefab, 32);
+    zombiePool = CreatePool(zombiePrefab, 16);
     
-    // Infinite Background System - 9 tiles in a 3x3 grid
+    // Background tiles are streamed in 1024x1024 chunks around the camera
     const float tileSize = 1024.0f;
-    auto bgController = CreateGameObject();
-    auto infiniteBg = bgController->AddComponent<InfiniteBackgroundScript>();
-    infiniteBg->tileSize = tileSize;
-    
-    // Load background texture once
-    auto bgTexture = assets().LoadTexture("Background", "background.png");
-    
-    // Create 9 background tiles
-    for (int y = -1; y <= 1; y++)
-    {
-        for (int x = -1; x <= 1; x++)
-        {
-            auto tile = CreateGameObject();
-            tile->GetTransform()->SetPosition({x * tileSize, y * tileSize, -0.5f});
-            tile->GetTransform()->SetScale({tileSize, tileSize, 1.0f});
-            auto tileRenderer = tile->AddComponent<SpriteRenderComponent>();
-            tileRenderer->SetTexture(bgTexture);
-            infiniteBg->tiles.push_back(tile);
-        }
-    }
+
+    StreamingConfig streaming;
+    streaming.chunkSize = tileSize;
+    streaming.loadRadius = 1;
+    streaming.unloadRadius = 2;
+    EnableStreaming(streaming, [tileSize](ChunkBlueprint& chunk) {
+        chunk.LoadTexture("Background", "background.png");
+        chunk.AddObject({tileSize * 0.5f, tileSize * 0.5f, -0.5f}, [tileSize](GameObject& tile, EngineContext& ctx) {
+            tile.GetTransform()->SetScale({tileSize, tileSize, 1.0f});
+            auto tileRenderer = tile.AddComponent<SpriteRenderComponent>();
+            tileRenderer->SetTexture(ctx.assetProvider->GetTexture("Background"));
+            tileRenderer->SetStatic(true);
+        });
+    });
 
     // Player GameObject
     player = CreateGameObject();
+    player->SetTag("Player");
     player->GetTransform()->SetPosition({0.0f, 0.0f, 0.0f});
     auto playerRenderer = player->AddComponent<SpriteRenderComponent>();
-    playerRenderer->SetTexture(assets().LoadTexture("PlayerSprite", "survivor_pistol.png"));
+    playerRenderer->SetSprite(assets().GetSprite("PlayerSprite"));
     player->GetTransform()->SetScale({100.0f, 100.0f, 1.0f});
     auto playerScript = player->AddComponent<PlayerScript>();
     playerScript->scene = this;
+    playerScript->bulletPool = bulletPool;
     
     // Setup player callbacks
     playerScript->onHealthChanged = [this](int health) {
@@ -71,26 +80,69 @@ void TwinStickScene::OnSceneEnter()
     auto crosshair = CreateGameObject();
     crosshair->GetTransform()->SetPosition({100.0f, 100.0f, 0.0f});
     auto crosshairRenderer = crosshair->AddComponent<SpriteRenderComponent>();
-    crosshairRenderer->SetTexture(assets().LoadTexture("Crosshair", "Reticle-66.png"));
+    crosshairRenderer->SetSprite(assets().GetSprite("Crosshair"));
     crosshair->GetTransform()->SetScale({100.0f, 100.0f, 1.0f});
     auto reticleScript = crosshair->AddComponent<ReticleScript>();
 
     // Create UI
-    CreateUI();
+    CreateUI(cameraGO);
 
     // Start first round
     StartNextRound();
 }
 
-void TwinStickScene::CreateUI()
+void TwinStickScene::CreatePrefabs()
+{
+    // Bullet: yellow circle moved by its RigidBody
+    bulletPrefab = Prefab{};
+    bulletPrefab.GetTransform()->SetScale({12.0f, 12.0f, 1.0f});
+
+    auto bulletRenderer = bulletPrefab.AddComponent<CircleRenderComponent>();
+    bulletRenderer->SetRadius(1.0f);
+    bulletRenderer->SetColor({255, 255, 0, 255}); // Yellow
+
+    auto bulletCollider = bulletPrefab.AddComponent<CircleColliderComponent>();
+    bulletCollider->SetRadius(1.0f);
+    bulletCollider->SetColliderType(ColliderType::Trigger);
+
+    auto bulletRb = bulletPrefab.AddComponent<RigidBody>();
+    bulletRb->mass = 0.1f;
+    bulletRb->drag = 0.0f; // No drag for bullets
+
+    bulletPrefab.AddComponent<BulletScript>();
+
+    // Zombie: sprite, trigger collider and chasing AI
+    zombiePrefab = Prefab{};
+    zombiePrefab.SetTag("Zombie");
+    zombiePrefab.GetTransform()->SetScale({80.0f, 80.0f, 1.0f});
+
+    auto zombieRenderer = zombiePrefab.AddComponent<SpriteRenderComponent>();
+    zombieRenderer->SetSprite(assets().GetSprite("ZombieSprite"));
+
+    auto zombieCollider = zombiePrefab.AddComponent<CircleColliderComponent>();
+    zombieCollider->SetRadius(0.5f);
+    zombieCollider->SetColliderType(ColliderType::Trigger);
+
+    // Set callback for when zombie dies
+    auto zombieScript = zombiePrefab.AddComponent<ZombieScript>();
+    zombieScript->onDeath = [this](int points) {
+        AddScore(points);
+        zombiesKilledThisRound++;
+    };
+}
+
+void TwinStickScene::CreateUI(GameObject* cameraGO)
 {
     // UI Controller GameObject
     auto uiController = CreateGameObject();
     gameUI = uiController->AddComponent<GameUIScript>();
-    
+
+    // Text objects are children of the camera, so positions are camera-relative
+
     // Score Text
     auto scoreGO = CreateGameObject();
-    scoreGO->GetTransform()->SetPosition({-480.0f, 350.0f, 0.9f});
+    scoreGO->SetParent(cameraGO);
+    scoreGO->GetTransform()->SetPosition({-350.0f, 350.0f, 0.9f});
     auto scoreText = scoreGO->AddComponent<TextRenderComponent>();
     scoreText->SetText("Score: 0");
     scoreText->SetColor({255, 255, 255, 255});
@@ -99,7 +151,8 @@ void TwinStickScene::CreateUI()
     
     // Health Text
     auto healthGO = CreateGameObject();
-    healthGO->GetTransform()->SetPosition({-480.0f, 310.0f, 0.9f});
+    healthGO->SetParent(cameraGO);
+    healthGO->GetTransform()->SetPosition({-350.0f, 310.0f, 0.9f});
     auto healthText = healthGO->AddComponent<TextRenderComponent>();
     healthText->SetText("Health: 100");
     healthText->SetColor({255, 100, 100, 255});
@@ -108,6 +161,7 @@ void TwinStickScene::CreateUI()
     
     // Round Text
     auto roundGO = CreateGameObject();
+    roundGO->SetParent(cameraGO);
     roundGO->GetTransform()->SetPosition({350.0f, 350.0f, 0.9f});
     auto roundText = roundGO->AddComponent<TextRenderComponent>();
     roundText->SetText("Round: 1");
@@ -117,6 +171,7 @@ void TwinStickScene::CreateUI()
     
     // Game Over Text (hidden initially)
     auto gameOverGO = CreateGameObject();
+    gameOverGO->SetParent(cameraGO);
     gameOverGO->GetTransform()->SetPosition({0.0f, 0.0f, 0.95f});
     auto gameOverText = gameOverGO->AddComponent<TextRenderComponent>();
     gameOverText->SetText("");
@@ -186,30 +241,11 @@ void TwinStickScene::SpawnZombie()
         0.0f
     );
 
-    auto zombie = CreateGameObject();
-    zombie->GetTransform()->SetPosition(spawnPos);
-    zombie->GetTransform()->SetScale({80.0f, 80.0f, 1.0f});
-    
-    // Render zombie with sprite
-    auto zombieRenderer = zombie->AddComponent<SpriteRenderComponent>();
-    zombieRenderer->SetTexture(assets().LoadTexture("ZombieSprite", "zombie.png"));
-
-    // Add collider
-    auto zombieCollider = zombie->AddComponent<CircleColliderComponent>();
-    zombieCollider->SetRadius(0.5f);
-    zombieCollider->SetColliderType(ColliderType::Trigger);
-
-    // Add AI script with death callback
-    auto zombieScript = zombie->AddComponent<ZombieScript>();
+    auto zombie = Acquire(*zombiePool, spawnPos);
     
     // Increase zombie speed each round
+    auto zombieScript = zombie->GetComponent<ZombieScript>();
     zombieScript->moveSpeed = 80.0f + (currentRound - 1) * 10.0f;
-    
-    // Set callback for when zombie dies
-    zombieScript->onDeath = [this](int points) {
-        AddScore(points);
-        zombiesKilledThisRound++;
-    };
 
     zombiesSpawnedThisRound++;
 }
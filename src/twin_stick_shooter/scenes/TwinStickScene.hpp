@@ -17,6 +17,8 @@ class TwinStickScene : public Scene
 public:
     using Scene::Scene;
 
+    void OnScenePreload() override;
+
     void OnSceneEnter() override;
 
     void OnSceneUpdate() override;
@@ -34,6 +36,12 @@ public:
 private:
     GameObject *player = nullptr;
     GameUIScript *gameUI = nullptr;
+
+    // Templates for the objects spawned during play, recycled through pools
+    Prefab bulletPrefab;
+    Prefab zombiePrefab;
+    ObjectPool *bulletPool = nullptr;
+    ObjectPool *zombiePool = nullptr;
     
     // Round system
     int currentRound = 1;
@@ -49,7 +57,8 @@ private:
 
     void SpawnZombie();
     void StartNextRound();
-    void CreateUI();
+    void CreateUI(GameObject* cameraGO);
+    void CreatePrefabs();
 };
 
 } // namespace Axion
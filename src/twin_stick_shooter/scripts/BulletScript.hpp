@@ -44,6 +44,18 @@ public:
         }
     }
 
+    void SaveState(StateWriter &writer) const override
+    {
+        writer.Write(direction);
+        writer.Write(currentLifetime);
+    }
+
+    void LoadState(StateReader &reader) override
+    {
+        reader.Read(direction);
+        reader.Read(currentLifetime);
+    }
+
     void OnTriggerEnter(GameObject &other) override
     {
         // Bullet will be destroyed when it hits a zombie (handled by ZombieScript)
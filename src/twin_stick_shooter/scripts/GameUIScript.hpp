@@ -24,45 +24,6 @@ public:
         UpdateUI();
     }
     
-    void Update(EngineContext &context) override
-    {
-        auto *owner = GetOwner();
-        if (!owner || owner->IsDestroyed()) return;
-        
-        // Follow camera position for UI
-        auto *scene = context.sceneProvider->GetCurrentScene();
-        if (!scene) return;
-        
-        auto *camera = scene->GetCurrentCamera();
-        if (!camera) return;
-        
-        auto *camOwner = camera->GetOwner();
-        if (!camOwner || camOwner->IsDestroyed()) return;
-        
-        auto *camTr = camOwner->GetTransform();
-        if (!camTr) return;
-        
-        glm::vec3 camPos = camTr->GetPosition();
-        
-        // Position UI elements relative to camera (top-left corner)
-        if (scoreText && scoreText->GetOwner())
-        {
-            scoreText->GetOwner()->GetTransform()->SetPosition({camPos.x - 350.0f, camPos.y + 350.0f, 0.9f});
-        }
-        if (healthText && healthText->GetOwner())
-        {
-            healthText->GetOwner()->GetTransform()->SetPosition({camPos.x - 350.0f, camPos.y + 310.0f, 0.9f});
-        }
-        if (roundText && roundText->GetOwner())
-        {
-            roundText->GetOwner()->GetTransform()->SetPosition({camPos.x + 350.0f, camPos.y + 350.0f, 0.9f});
-        }
-        if (gameOverText && gameOverText->GetOwner())
-        {
-            gameOverText->GetOwner()->GetTransform()->SetPosition({camPos.x, camPos.y, 0.95f});
-        }
-    }
-    
     void AddScore(int points)
     {
         score += points;
@@ -81,6 +42,29 @@ public:
         UpdateUI();
     }
     
+    void SaveState(StateWriter &writer) const override
+    {
+        writer.Write(score);
+        writer.Write(health);
+        writer.Write(currentRound);
+        writer.Write(isGameOver);
+    }
+
+    // The texts are rebuilt from the restored values
+    void LoadState(StateReader &reader) override
+    {
+        reader.Read(score);
+        reader.Read(health);
+        reader.Read(currentRound);
+        reader.Read(isGameOver);
+
+        UpdateUI();
+        if (isGameOver)
+            ShowGameOver();
+        else
+            HideGameOver();
+    }
+
     void ShowGameOver()
     {
         isGameOver = true;
@@ -16,6 +16,7 @@ public:
     float sprintMultiplier = 1.8f;
     float shootCooldown = 0.25f;
     Scene *scene = nullptr;
+    ObjectPool *bulletPool = nullptr;
     
     // Health system
     int maxHealth = 100;
@@ -54,6 +55,22 @@ public:
         }
     }
 
+    void SaveState(StateWriter &writer) const override
+    {
+        writer.Write(currentHealth);
+        writer.Write(isDead);
+        writer.Write(lastShootTime);
+        writer.Write(lastDamageTime);
+    }
+
+    void LoadState(StateReader &reader) override
+    {
+        reader.Read(currentHealth);
+        reader.Read(isDead);
+        reader.Read(lastShootTime);
+        reader.Read(lastDamageTime);
+    }
+
     void Update(EngineContext &context) override
     {
         auto *owner = GetOwner();
@@ -111,8 +128,8 @@ public:
 
         // Get mouse position and convert to world coordinates
         SDL_Point mousePos = input->GetMousePosition();
-        int winW = 0, winH = 0;
-        SDL_GetWindowSize(window->GetSDLWindow(), &winW, &winH);
+        const glm::ivec2 winSize = window->GetSize();
+        const int winW = winSize.x, winH = winSize.y;
 
         // Get camera position to adjust world coordinates
         glm::vec3 cameraPos(0.0f);
@@ -163,31 +180,12 @@ private:
 
     void ShootBullet(EngineContext &context, const glm::vec3 &position, const glm::vec2 &direction)
     {
-        if (!scene)
+        if (!scene || !bulletPool)
             return;
 
-        // Create bullet GameObject
-        auto bullet = scene->CreateGameObject();
-        bullet->GetTransform()->SetPosition(position);
-        bullet->GetTransform()->SetScale({12.0f, 12.0f, 1.0f});
-
-        // Add visual component (circle)
-        auto bulletRenderer = bullet->AddComponent<CircleRenderComponent>();
-        bulletRenderer->SetRadius(1.0f);
-        bulletRenderer->SetColor({255, 255, 0, 255}); // Yellow
-
-        // Add collider
-        auto bulletCollider = bullet->AddComponent<CircleColliderComponent>();
-        bulletCollider->SetRadius(1.0f);
-        bulletCollider->SetColliderType(ColliderType::Trigger);
-
-        // Add RigidBody for physics-based movement
-        auto bulletRb = bullet->AddComponent<RigidBody>();
-        bulletRb->mass = 0.1f;
-        bulletRb->drag = 0.0f; // No drag for bullets
-
-        // Add bullet script and set direction
-        auto bulletScript = bullet->AddComponent<BulletScript>();
+        // Reuse a pooled bullet and set its direction
+        auto bullet = scene->Acquire(*bulletPool, position);
+        auto bulletScript = bullet->GetComponent<BulletScript>();
         bulletScript->direction = direction;
     }
 };
@@ -30,9 +30,9 @@ public:
         int mouseX = mousePos.x;
         int mouseY = mousePos.y;
 
-        // Get window size using SDL directly
-        int winW = 0, winH = 0;
-        SDL_GetWindowSize(window->GetSDLWindow(), &winW, &winH);
+        // Get window size (also valid when headless)
+        const glm::ivec2 winSize = window->GetSize();
+        const int winW = winSize.x, winH = winSize.y;
         
         // Get camera position to adjust world coordinates
         glm::vec3 cameraPos(0.0f);
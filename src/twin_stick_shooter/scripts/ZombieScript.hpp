@@ -11,13 +11,20 @@ namespace Axion
 // Forward declarations
 class PlayerScript;
 
-class ZombieScript : public ScriptableComponent
+// Zombies chase the player on worker threads: each one only reads the
+// player's transform and writes its own.
+class ZombieScript : public ScriptableComponent, public IParallelUpdateable
 {
 public:
     float moveSpeed = 80.0f;
+    float maxHealth = 100.0f;
     float health = 100.0f;
     int damageToPlayer = 20;
     int scoreValue = 100; // Points given when killed
+
+    // Zombies further than this from the player only think at farThinkRate
+    float farDistance = 900.0f;
+    float farThinkRate = 10.0f;
     
     // Callback when zombie dies (for score)
     std::function<void(int points)> onDeath = nullptr;
@@ -26,7 +33,29 @@ public:
     {
     }
 
-    void Update(EngineContext &context) override
+    // Zombies are pooled: a reused one comes back at full health
+    void OnReset(EngineContext &context) override
+    {
+        health = maxHealth;
+    }
+
+    // Health is the only state that changes while playing
+    void SaveState(StateWriter &writer) const override
+    {
+        writer.Write(health);
+    }
+
+    void LoadState(StateReader &reader) override
+    {
+        reader.Read(health);
+    }
+
+    void DeclareAccess(AccessSet &access) const override
+    {
+        access.Reads<TransformComponent>().Writes<TransformComponent>();
+    }
+
+    void ParallelUpdate(EngineContext &context) override
     {
         auto *owner = GetOwner();
         if (!owner || owner->IsDestroyed()) return;
@@ -39,7 +68,8 @@ public:
         if (!player)
             return;
 
-        float deltaTime = context.timeProvider->GetDeltaTime();
+        // Time since this zombie last thought, which is more than a frame when far away
+        float deltaTime = GetUpdateDeltaTime();
         
         // Get direction to player
         glm::vec3 zombiePos = tr->GetPosition();
@@ -50,6 +80,12 @@ public:
         glm::vec3 playerPos = playerTr->GetPosition();
         glm::vec2 direction(playerPos.x - zombiePos.x, playerPos.y - zombiePos.y);
 
+        // Off-screen zombies do not need per-frame steering
+        if (glm::length(direction) > farDistance)
+            SetUpdateRate(farThinkRate);
+        else
+            SetUpdateEveryFrame();
+
         // Move towards player
         if (glm::length(direction) > 0.0f)
         {
@@ -113,21 +149,9 @@ private:
         if (!currentScene)
             return nullptr;
         
-        // Find player by checking if it has PlayerScript component
-        auto allObjects = currentScene->GetGameObjects();
-        for (auto *obj : allObjects)
-        {
-            if (obj && !obj->IsDestroyed())
-            {
-                // Try to find PlayerScript component
-                auto playerScript = obj->GetComponent<PlayerScript>();
-                if (playerScript)
-                {
-                    return obj;
-                }
-            }
-        }
-        return nullptr;
+        // Tag index lookup, no scan over the scene objects
+        static const NameId playerTag = NameRegistry::Intern("Player");
+        return currentScene->FindByTag(playerTag);
     }
 };
 